@@ -0,0 +1,1293 @@
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <set>
+#include <streambuf>
+#include <string>
+#include <typeindex>
+#include <variant>
+#include <vector>
+
+#include "ion/diagnostics.h"
+#include "ion/lexer.h"
+#include "ion/resolver.h"
+#include "ion/source_file.h"
+#include "ion/ast/visitor.h"
+#include "ion/parsing/parser.h"
+
+struct GeneratorOptions
+{
+    uint32_t seed = 1;
+    size_t file_size = 64 * 1024;
+    int file_count = 1;
+    /** Declarators per instance constructor */
+    int instance_declarators = 12;
+    /** Members per interface */
+    int interface_members = 8;
+    /** Cases per match statement */
+    int match_cases = 6;
+    /** How deep control flow statements nest */
+    int nesting_depth = 4;
+    /** Leaves out `return` and `await`, which the resolver currently reports in any context */
+    bool resolvable = false;
+};
+
+/** Only uses mt19937's raw output (which the standard fully specifies), never the implementation-defined distributions */
+class Random
+{
+    std::mt19937 engine_;
+
+public:
+    explicit Random(const uint32_t seed)
+        : engine_(seed)
+    {
+    }
+
+    uint32_t below(const uint32_t bound)
+    {
+        return engine_() % bound;
+    }
+
+    bool one_in(const uint32_t count)
+    {
+        return below(count) == 0;
+    }
+
+    template <typename T, size_t N>
+    const T& pick(const T (&items)[N])
+    {
+        return items[below(N)];
+    }
+
+    const std::string& pick(const std::vector<std::string>& items)
+    {
+        return items[below(static_cast<uint32_t>(items.size()))];
+    }
+};
+
+/** Cycles through every form once before picking them at random, so even small outputs cover everything */
+class FormPicker
+{
+    int next_ = 0;
+    int form_count_ = 0;
+
+public:
+    int pick(Random& random, const int form_count)
+    {
+        form_count_ = form_count;
+        return next_ < form_count ? next_++ : static_cast<int>(random.below(form_count));
+    }
+
+    /** Whether every form has been picked at least once */
+    bool cycled() const
+    {
+        return form_count_ > 0 && next_ >= form_count_;
+    }
+};
+
+struct GeneratedModule
+{
+    std::string name;
+    std::string source;
+    std::vector<std::string> exports;
+};
+
+/**
+ * Emits one module of a valid Ion program. Every name it declares is unique within the module, because the resolver
+ * checks instance and interface members for duplicates across the whole file rather than per declaration.
+ */
+class ModuleGenerator
+{
+    const GeneratorOptions& options_;
+    Random& random_;
+    std::string source_;
+    int indent_ = 0;
+    /** Shared by all modules, so imported names never collide with a module's own */
+    int& next_name_;
+    int loop_depth_ = 0;
+    int function_depth_ = 0;
+    bool in_async_function_ = false;
+    bool named_instance_emitted_ = false;
+    bool clone_emitted_ = false;
+    bool await_emitted_ = false;
+    bool async_emitted_ = false;
+    bool decorator_emitted_ = false;
+    bool interface_method_emitted_ = false;
+    bool return_emitted_ = false;
+
+    std::vector<std::vector<std::string>> values_ = { {} };
+    std::vector<std::string> functions_;
+    /** How many functions were visible when each scope was pushed, nested functions go out of scope with it */
+    std::vector<size_t> scope_function_counts_;
+    std::vector<std::string> events_;
+    std::vector<std::pair<std::string, std::vector<std::string>>> enums_;
+    /** Declared type names and how many type arguments they take */
+    std::vector<std::pair<std::string, int>> types_;
+    std::vector<std::string> type_parameters_;
+    std::vector<std::string> exports_;
+
+    FormPicker top_level_forms_;
+    FormPicker statement_forms_;
+    FormPicker expression_forms_;
+    FormPicker atom_forms_;
+    FormPicker type_forms_;
+    FormPicker assignment_forms_;
+    FormPicker binary_forms_;
+    FormPicker loop_exit_forms_;
+    FormPicker declarator_forms_;
+
+    std::string fresh(const std::string& prefix)
+    {
+        return prefix + std::to_string(next_name_++);
+    }
+
+    void line(const std::string& text)
+    {
+        source_.append(indent_ * 4, ' ');
+        source_ += text;
+        source_ += '\n';
+    }
+
+    void declare_value(const std::string& name)
+    {
+        values_.back().push_back(name);
+    }
+
+    std::string any_value()
+    {
+        size_t count = 0;
+        for (const auto& scope : values_)
+            count += scope.size();
+
+        auto index = random_.below(static_cast<uint32_t>(count));
+        for (const auto& scope : values_)
+        {
+            if (index < scope.size())
+                return scope[index];
+
+            index -= static_cast<uint32_t>(scope.size());
+        }
+
+        return values_.front().front();
+    }
+
+    std::string number_literal()
+    {
+        static constexpr const char* numbers[] = {
+            "42", "1_000", "0xFF", "0o17", "0b1011", "1.5e3", "2.5", "10s", "50ms", "1h", "20hz", "50%", "2d", "3m"
+        };
+
+        return numbers[atom_forms_.pick(random_, static_cast<int>(std::size(numbers)))];
+    }
+
+    /** Ranges only take integer bounds, `2.5..` would be lexed as a malformed number */
+    std::string range_bound()
+    {
+        static constexpr const char* bounds[] = { "1", "10", "42", "1_000" };
+        return random_.pick(bounds);
+    }
+
+    std::string atom()
+    {
+        switch (random_.below(8))
+        {
+            case 0:
+            case 1:
+            case 2:
+                return any_value();
+            case 3:
+            case 4:
+                return number_literal();
+            case 5:
+                return random_.one_in(2) ? "\"text\\tvalue\\n\"" : "'single'";
+            case 6:
+                return random_.one_in(2) ? "true" : "false";
+            default:
+                return "null";
+        }
+    }
+
+    std::string type_arguments_for(const int count)
+    {
+        std::string text = "<";
+        for (auto i = 0; i < count; i++)
+            text += (i > 0 ? ", " : "") + std::string(random_.one_in(2) ? "number" : "string");
+
+        return text + '>';
+    }
+
+    /** Type arguments of an invocation can only be plain or generic names */
+    std::string invocation_type_arguments()
+    {
+        if (random_.one_in(3))
+            return "";
+
+        const auto& [name, arity] = types_[random_.below(static_cast<uint32_t>(types_.size()))];
+        const auto type_name = arity > 0 ? name + type_arguments_for(arity) : name;
+        return random_.one_in(2) ? '<' + type_name + '>' : "<number, " + type_name + '>';
+    }
+
+    std::string argument_list(const int depth, const int count)
+    {
+        std::string text;
+        for (auto i = 0; i < count; i++)
+            text += (i > 0 ? ", " : "") + expression(depth);
+
+        return text;
+    }
+
+    std::string binary_expression(const int depth)
+    {
+        static constexpr const char* operators[] = {
+            "+", "-", "*", "/", "//", "%", "^", "&", "|", "~", "<<", ">>", ">>>", "&&", "||", "??"
+        };
+        static constexpr const char* comparisons[] = { "==", "!=", "<", "<=", ">", ">=" };
+
+        const auto form = binary_forms_.pick(random_, static_cast<int>(std::size(operators) + std::size(comparisons)));
+        if (form < static_cast<int>(std::size(operators)))
+            return expression(depth - 1) + ' ' + operators[form] + ' ' + expression(depth - 1);
+
+        // a name right after `<` could be read as the start of type arguments, so comparisons are against numbers
+        return expression(depth - 1) + ' ' + comparisons[form - std::size(operators)] + ' ' + number_literal();
+    }
+
+    std::string interpolated_string(const int depth)
+    {
+        std::string text = "\"part ";
+        const auto interpolation_count = 1 + random_.below(3);
+        for (uint32_t i = 0; i < interpolation_count; i++)
+            text += "#{" + (i == 1 ? "\"nested #{" + any_value() + "}\"" : expression(depth - 1)) + "} part ";
+
+        return text + '"';
+    }
+
+    std::string expression(const int depth)
+    {
+        if (depth <= 0)
+            return atom();
+
+        switch (expression_forms_.pick(random_, 21))
+        {
+            case 0:
+                return atom();
+            case 1:
+            case 2:
+                return binary_expression(depth);
+            case 3:
+            {
+                static constexpr const char* operators[] = { "-", "!", "~" };
+                const auto operand = random_.one_in(2) ? any_value() : '(' + expression(depth - 1) + ')';
+                return random_.pick(operators) + operand;
+            }
+            case 4:
+                return '(' + expression(depth - 1) + ')';
+            case 5:
+                return '(' + expression(depth - 1) + " ? " + expression(depth - 1) + " : " + expression(depth - 1) + ')';
+            case 6:
+                return random_.pick(functions_) + invocation_type_arguments() + '(' + argument_list(depth - 1, random_.below(3)) + ')';
+            case 7:
+                return random_.pick(events_) + "!(" + argument_list(depth - 1, 1) + ')';
+            case 8:
+            {
+                static constexpr const char* accessors[] = { ".", "::", "@" };
+                return any_value() + random_.pick(accessors) + fresh("member");
+            }
+            case 9:
+            {
+                const auto& [enum_name, members] = enums_[random_.below(static_cast<uint32_t>(enums_.size()))];
+                return enum_name + "::" + random_.pick(members);
+            }
+            case 10:
+                return any_value() + "?." + fresh("member");
+            case 11:
+                return any_value() + '[' + expression(depth - 1) + ']';
+            case 12:
+                return '[' + argument_list(depth - 1, static_cast<int>(random_.below(4))) + ']';
+            case 13:
+                return '(' + argument_list(depth - 1, 2 + static_cast<int>(random_.below(2))) + ')';
+            case 14:
+                return range_bound() + ".." + range_bound();
+            case 15:
+                return "rgb<(" + argument_list(depth - 1, 3) + ")>";
+            case 16:
+                return "hsv<(" + argument_list(depth - 1, 3) + ")>";
+            case 17:
+                return "<(" + argument_list(depth - 1, 3) + ")>";
+            case 18:
+                return interpolated_string(depth);
+            case 19:
+                // typeof and await take a whole expression, so they're parenthesized to end where intended
+                return "(typeof " + expression(depth - 1) + ')';
+            default:
+            {
+                if (in_async_function_ && !options_.resolvable && random_.one_in(2))
+                    return "(await " + random_.pick(functions_) + "())";
+
+                return "nameof " + (random_.one_in(2) ? any_value() : enums_.front().first + "::" + enums_.front().second.front());
+            }
+        }
+    }
+
+    std::string type_ref(const int depth)
+    {
+        static constexpr const char* primitives[] = { "number", "string", "bool", "void" };
+        if (depth <= 0)
+            return random_.pick(primitives);
+
+        switch (type_forms_.pick(random_, 10))
+        {
+            case 0:
+                return random_.pick(primitives);
+            case 1:
+            {
+                const auto& [name, arity] = types_[random_.below(static_cast<uint32_t>(types_.size()))];
+                return arity > 0 ? name + type_arguments_for(arity) : name;
+            }
+            case 2:
+                return type_ref(0) + '?';
+            case 3:
+            {
+                static constexpr const char* literals[] = { "\"literal\"", "1", "true", "false" };
+                return std::string(random_.pick(literals)) + " | " + random_.pick(literals);
+            }
+            case 4:
+                return type_ref(0) + "[]" + (random_.one_in(2) ? "[]" : "");
+            case 5:
+                return type_ref(0) + " | " + type_ref(0);
+            case 6:
+                return type_ref(0) + " & " + type_ref(0);
+            case 7:
+            {
+                const auto type_parameter = fresh("T");
+                return '<' + type_parameter + ">(" + type_ref(0) + ", " + type_parameter + ") -> " + type_parameter;
+            }
+            case 8:
+                return '(' + type_ref(0) + ", " + type_ref(0) + ')';
+            default:
+                return type_parameters_.empty() ? random_.pick(primitives) : random_.pick(type_parameters_);
+        }
+    }
+
+    /** Type parameters for a declaration, each of them usable by `type_ref()` afterwards */
+    std::string type_parameter_list()
+    {
+        if (random_.one_in(2))
+            return "";
+
+        std::string text = "<";
+        const auto count = 1 + random_.below(2);
+        for (uint32_t i = 0; i < count; i++)
+        {
+            const auto name = fresh("T");
+            text += (i > 0 ? ", " : "") + name;
+            if (random_.one_in(3))
+                text += ": " + type_ref(0);
+            if (random_.one_in(3))
+                text += " = " + type_ref(0);
+
+            type_parameters_.push_back(name);
+        }
+
+        return text + '>';
+    }
+
+    void push_scope()
+    {
+        values_.emplace_back();
+        scope_function_counts_.push_back(functions_.size());
+    }
+
+    void pop_scope()
+    {
+        values_.pop_back();
+        functions_.resize(scope_function_counts_.back());
+        scope_function_counts_.pop_back();
+    }
+
+    void block(const int depth, const int statement_count)
+    {
+        source_.pop_back();
+        source_ += " {\n";
+        indent_++;
+        push_scope();
+        if (in_async_function_ && !options_.resolvable && (!await_emitted_ || random_.one_in(3)))
+        {
+            line("await " + random_.pick(functions_) + "()");
+            await_emitted_ = true;
+        }
+
+        for (auto i = 0; i < statement_count; i++)
+            statement(depth - 1);
+
+        // statements after these would be unreachable
+        if (loop_depth_ > 0 && (!loop_exit_forms_.cycled() || random_.one_in(3)))
+            line(loop_exit_forms_.pick(random_, 2) == 0 ? "break" : "continue");
+        else if (function_depth_ > 0 && !options_.resolvable && (!return_emitted_ || random_.one_in(3)))
+        {
+            line(random_.one_in(2) ? "return " + expression(1) : "return");
+            return_emitted_ = true;
+        }
+
+        pop_scope();
+        indent_--;
+        line("}");
+    }
+
+    /** The body of a control flow statement: a block, or a single statement on the next line */
+    void body(const int depth)
+    {
+        if (depth > 0 && !random_.one_in(4))
+        {
+            block(depth, 1 + static_cast<int>(random_.below(3)));
+            return;
+        }
+
+        indent_++;
+        // declarations in a single statement body would land in the enclosing scope, so names they declare aren't used
+        push_scope();
+        simple_statement();
+        pop_scope();
+        indent_--;
+    }
+
+    std::string condition()
+    {
+        return binary_expression(1);
+    }
+
+    void variable_declaration(const bool exported = false)
+    {
+        const auto name = fresh("value");
+        const auto is_const = random_.one_in(2);
+        std::string text = exported ? "export let " : "let ";
+        if (is_const)
+            text += "const ";
+
+        text += name;
+        if (random_.one_in(3))
+            text += ": " + type_ref(1);
+
+        text += " = " + expression(2);
+        line(text + (random_.one_in(2) ? ";" : ""));
+        declare_value(name);
+        if (exported)
+            exports_.push_back(name);
+    }
+
+    void expression_statement()
+    {
+        static constexpr const char* assignments[] = {
+            "=", "+=", "-=", "*=", "/=", "//=", "%=", "^=", "&=", "|=", "~=", "<<=", ">>=", ">>>=", "&&=", "||="
+        };
+
+        const auto form = assignment_forms_.pick(random_, static_cast<int>(std::size(assignments)) + 4);
+        if (form < static_cast<int>(std::size(assignments)))
+            line(any_value() + ' ' + assignments[form] + ' ' + expression(2));
+        else if (form < static_cast<int>(std::size(assignments)) + 2)
+            line(any_value() + (form == std::size(assignments) ? "++" : "--"));
+        else if (form == std::size(assignments) + 2)
+            line(random_.pick(functions_) + invocation_type_arguments() + '(' + argument_list(1, random_.below(3)) + ')');
+        else
+            line(random_.pick(events_) + "!(" + expression(1) + ')');
+    }
+
+    /** A statement that fits on one line */
+    void simple_statement()
+    {
+        if (random_.one_in(2))
+            variable_declaration();
+        else
+            expression_statement();
+    }
+
+    void if_statement(const int depth)
+    {
+        line("if " + condition());
+        body(depth);
+        if (random_.one_in(2))
+        {
+            line("else if " + condition());
+            body(depth);
+        }
+
+        if (random_.one_in(2))
+        {
+            line("else");
+            body(depth);
+        }
+    }
+
+    template <typename F>
+    void loop(F&& emit)
+    {
+        loop_depth_++;
+        emit();
+        loop_depth_--;
+    }
+
+    void match_statement(const int depth)
+    {
+        line("match " + any_value() + " {");
+        indent_++;
+        for (auto i = 0; i < options_.match_cases; i++)
+        {
+            const auto comparands = random_.one_in(3) ? number_literal() + ", " + number_literal() : expression(1);
+            if (random_.one_in(3))
+            {
+                line(comparands + " ->");
+                block(depth, 1);
+                source_.insert(source_.size() - 1, ",");
+            }
+            else
+                line(comparands + " -> " + expression(1) + ',');
+        }
+
+        line("else " + fresh("other") + " -> " + expression(1));
+        indent_--;
+        line("}");
+    }
+
+    void statement(const int depth)
+    {
+        if (depth <= 0)
+        {
+            simple_statement();
+            return;
+        }
+
+        switch (statement_forms_.pick(random_, 12))
+        {
+            case 0:
+                if_statement(depth);
+                break;
+            case 1:
+                loop([&]
+                {
+                    line("while " + condition());
+                    body(depth);
+                });
+                break;
+            case 2:
+                loop([&]
+                {
+                    line("repeat");
+                    body(depth);
+                    line("while " + condition());
+                });
+                break;
+            case 3:
+                loop([&]
+                {
+                    line(random_.one_in(2)
+                             ? "for " + fresh("i") + " : " + range_bound() + ".." + range_bound()
+                             : "for " + fresh("key") + ", " + fresh("item") + " : " + any_value());
+                    body(depth);
+                });
+                break;
+            case 4:
+                line("after " + number_literal());
+                body(depth);
+                break;
+            case 5:
+                loop([&]
+                {
+                    line("every " + number_literal() + " while " + condition());
+                    body(depth);
+                });
+                break;
+            case 6:
+                match_statement(depth);
+                break;
+            case 7:
+                line("");
+                source_.pop_back();
+                block(depth, 2);
+                break;
+            case 8:
+                function_declaration(depth, false);
+                break;
+            default:
+                simple_statement();
+                break;
+        }
+    }
+
+    void function_declaration(const int depth, const bool exported)
+    {
+        const auto name = fresh("function");
+        const auto is_async = !async_emitted_ || random_.one_in(4);
+        async_emitted_ = true;
+        if ((!decorator_emitted_ || random_.one_in(3)) && !functions_.empty())
+        {
+            // a decorator right after an expression would be read as an attribute access on it, and a semicolon
+            // can't follow a block
+            const auto last_character = source_.find_last_not_of(" \n");
+            if (last_character != std::string::npos && source_[last_character] != '{' && source_[last_character] != '}')
+                line(";");
+
+            line('@' + random_.pick(functions_) + (random_.one_in(2) ? "(" + argument_list(1, 2) + ')' : ""));
+            decorator_emitted_ = true;
+        }
+
+        const auto type_parameter_count = type_parameters_.size();
+        std::string text = exported ? "export " : "";
+        text += (is_async ? "async fn " : "fn ") + name;
+        declare_value(name);
+        push_scope();
+        text += type_parameter_list();
+
+        if (!random_.one_in(4))
+        {
+            text += '(';
+            const auto parameter_count = random_.below(4);
+            for (uint32_t i = 0; i < parameter_count; i++)
+            {
+                const auto parameter = fresh("parameter");
+                text += (i > 0 ? ", " : "") + parameter;
+                if (!random_.one_in(3))
+                    text += ": " + type_ref(1);
+                if (random_.one_in(3))
+                    text += " = " + expression(1);
+
+                declare_value(parameter);
+            }
+
+            text += ')';
+        }
+
+        // tuple and function types would swallow an expression body's arrow
+        if (random_.one_in(2))
+            text += ": " + std::string(random_.one_in(2) ? "number" : "void");
+
+        const auto was_async = in_async_function_;
+        const auto enclosing_loop_depth = loop_depth_;
+        in_async_function_ = is_async;
+        loop_depth_ = 0;
+        function_depth_++;
+        // `block` is where the first `await` goes
+        const auto awaits_in_block = is_async && !await_emitted_ && !options_.resolvable;
+        if (random_.one_in(3) && !awaits_in_block)
+            line(text + " -> " + expression(2));
+        else
+        {
+            line(text);
+            block(std::max(depth, 1), 1 + static_cast<int>(random_.below(4)));
+        }
+
+        function_depth_--;
+        loop_depth_ = enclosing_loop_depth;
+        in_async_function_ = was_async;
+        type_parameters_.resize(type_parameter_count);
+        pop_scope();
+        functions_.push_back(name);
+        if (exported)
+            exports_.push_back(name);
+    }
+
+    void event_declaration()
+    {
+        const auto name = fresh("event");
+        const auto type_parameter_count = type_parameters_.size();
+        std::string text = "event " + name + type_parameter_list();
+        if (!random_.one_in(4))
+            text += '(' + type_ref(1) + (random_.one_in(2) ? ", " + type_ref(0) : "") + ')';
+
+        line(text);
+        type_parameters_.resize(type_parameter_count);
+        declare_value(name);
+        events_.push_back(name);
+    }
+
+    void type_declaration()
+    {
+        const auto name = fresh("Alias");
+        const auto type_parameter_count = type_parameters_.size();
+        const auto type_parameters = type_parameter_list();
+        line("type " + name + type_parameters + " = " + type_ref(2));
+        type_parameters_.resize(type_parameter_count);
+        declare_value(name);
+        types_.emplace_back(name, 0);
+    }
+
+    void enum_declaration()
+    {
+        const auto name = fresh("Enum");
+        std::vector<std::string> members;
+        std::string text = "enum " + name + " {";
+        const auto member_count = 2 + random_.below(6);
+        for (uint32_t i = 0; i < member_count; i++)
+        {
+            members.push_back(fresh("Member"));
+            text += ' ' + members.back();
+            if (random_.one_in(3))
+                text += " = " + std::to_string(i * 10);
+        }
+
+        line(text + " }");
+        declare_value(name);
+        enums_.emplace_back(name, std::move(members));
+    }
+
+    void interface_declaration()
+    {
+        const auto name = fresh("Interface");
+        const auto type_parameter_count = type_parameters_.size();
+        line("interface " + name + type_parameter_list() + " {");
+        indent_++;
+        for (auto i = 0; i < options_.interface_members; i++)
+        {
+            const auto terminator = random_.one_in(2) ? ";" : "";
+            if (!interface_method_emitted_ || random_.one_in(3))
+            {
+                interface_method_emitted_ = true;
+                const auto method_type_parameter_count = type_parameters_.size();
+                const auto type_parameters = type_parameter_list();
+                line("fn " + fresh("method") + type_parameters + '(' + type_ref(0) + ", " + type_ref(1) + "): " + type_ref(1) + terminator);
+                type_parameters_.resize(method_type_parameter_count);
+            }
+            else
+                line(std::string(random_.one_in(3) ? "const " : "") + fresh("field") + ": " + type_ref(1) + terminator);
+        }
+
+        indent_--;
+        line("}");
+        const auto arity = static_cast<int>(type_parameters_.size() - type_parameter_count);
+        type_parameters_.resize(type_parameter_count);
+        declare_value(name);
+        types_.emplace_back(name, arity);
+    }
+
+    void instance_constructor()
+    {
+        const auto name = fresh("instance");
+        auto text = "instance " + name + ": " + types_.front().first;
+        if (!clone_emitted_ || random_.one_in(4))
+        {
+            text += " clone " + any_value();
+            clone_emitted_ = true;
+        }
+
+        line(text + " {");
+        indent_++;
+        // the resolver allows one name declarator per file
+        if (!named_instance_emitted_)
+        {
+            line("\"" + name + "\"");
+            named_instance_emitted_ = true;
+        }
+
+        auto after_expression = false;
+        for (auto i = 0; i < options_.instance_declarators; i++)
+        {
+            switch (declarator_forms_.pick(random_, 3))
+            {
+                case 0:
+                    line(fresh("Property") + ": " + expression(2));
+                    after_expression = true;
+                    break;
+                case 1:
+                    // an attribute right after an expression would be read as an attribute access on it
+                    if (after_expression)
+                        line('#' + fresh("Tag"));
+
+                    line('@' + fresh("Attribute") + ": " + expression(1));
+                    after_expression = true;
+                    break;
+                default:
+                    line('#' + fresh("Tag"));
+                    after_expression = false;
+                    break;
+            }
+        }
+
+        indent_--;
+        line(random_.one_in(3) ? "}" : "} -> " + any_value());
+        declare_value(name);
+    }
+
+    void prelude(const std::vector<GeneratedModule>& modules)
+    {
+        // import from up to two earlier modules, so that the modules form a graph without cycles
+        auto imported = false;
+        const auto import_count = std::min<size_t>(modules.size(), 2);
+        for (size_t i = 0; i < import_count; i++)
+        {
+            const auto& module = modules[random_.below(static_cast<uint32_t>(modules.size()))];
+            if (module.exports.empty())
+                continue;
+
+            std::vector<std::string> names;
+            for (auto j = 0; j < 3; j++)
+            {
+                const auto& exported_name = random_.pick(module.exports);
+                if (std::ranges::find(names, exported_name) == names.end()
+                    && std::ranges::none_of(values_.front(), [&](const std::string& value) { return value == exported_name; }))
+                    names.push_back(exported_name);
+            }
+
+            if (names.empty())
+                continue;
+
+            std::string text = "import ";
+            for (size_t j = 0; j < names.size(); j++)
+                text += (j > 0 ? ", " : "") + names[j];
+
+            line(text + " from " + module.name);
+            for (const auto& imported_name : names)
+                declare_value(imported_name);
+
+            imported = true;
+        }
+
+        // the resolver doesn't look imported modules up yet, so a module with nothing to import from can import
+        // everything from one outside of the corpus
+        if (!imported)
+            line("import * from runtime");
+
+        line("interface Part {}");
+        types_.emplace_back("Part", 0);
+        declare_value("Part");
+        line("let counter = 0");
+        declare_value("counter");
+        line("let items = [1, 2, 3]");
+        declare_value("items");
+        line("fn log(message: string): void -> message");
+        declare_value("log");
+        functions_.push_back("log");
+        line("event changed(number)");
+        declare_value("changed");
+        events_.push_back("changed");
+        enum_declaration();
+        line("");
+    }
+
+    void top_level_item()
+    {
+        switch (top_level_forms_.pick(random_, 11))
+        {
+            case 0:
+                variable_declaration();
+                break;
+            case 1:
+                function_declaration(options_.nesting_depth, false);
+                break;
+            case 2:
+                event_declaration();
+                break;
+            case 3:
+                type_declaration();
+                break;
+            case 4:
+                enum_declaration();
+                break;
+            case 5:
+                interface_declaration();
+                break;
+            case 6:
+                instance_constructor();
+                break;
+            case 7:
+            case 8:
+                statement(options_.nesting_depth);
+                break;
+            case 9:
+                expression_statement();
+                break;
+            default:
+                if (random_.one_in(2))
+                    variable_declaration(true);
+                else
+                    function_declaration(1, true);
+                break;
+        }
+    }
+
+public:
+    ModuleGenerator(const GeneratorOptions& options, Random& random, int& next_name)
+        : options_(options),
+          random_(random),
+          next_name_(next_name)
+    {
+    }
+
+    GeneratedModule generate(const std::string& name, const std::vector<GeneratedModule>& previous_modules)
+    {
+        line("## Generated by IonCorpusGen (seed " + std::to_string(options_.seed) + ")");
+        prelude(previous_modules);
+        // every form gets its turn, however small the module is meant to be
+        while (source_.size() < options_.file_size || !top_level_forms_.cycled() || !statement_forms_.cycled()
+               || !expression_forms_.cycled() || !type_forms_.cycled() || !assignment_forms_.cycled()
+               || !binary_forms_.cycled() || !loop_exit_forms_.cycled())
+        {
+            top_level_item();
+            line("");
+        }
+
+        return { name, std::move(source_), std::move(exports_) };
+    }
+};
+
+/** Swallows the logger's output while generated modules are checked */
+class NullBuffer final : public std::streambuf
+{
+protected:
+    int overflow(const int character) override
+    {
+        return character;
+    }
+};
+
+#define NODE_TYPE(name) std::pair { std::type_index(typeid(name)), #name }
+
+const std::vector node_types = {
+    NODE_TYPE(PrimitiveLiteral), NODE_TYPE(ArrayLiteral), NODE_TYPE(TupleLiteral), NODE_TYPE(RangeLiteral),
+    NODE_TYPE(RgbLiteral), NODE_TYPE(HsvLiteral), NODE_TYPE(VectorLiteral), NODE_TYPE(Identifier),
+    NODE_TYPE(InterpolatedString), NODE_TYPE(Parenthesized), NODE_TYPE(BinaryOp), NODE_TYPE(UnaryOp),
+    NODE_TYPE(PostfixUnaryOp), NODE_TYPE(AssignmentOp), NODE_TYPE(TernaryOp), NODE_TYPE(Invocation), NODE_TYPE(TypeOf),
+    NODE_TYPE(NameOf), NODE_TYPE(Await), NODE_TYPE(MemberAccess), NODE_TYPE(OptionalMemberAccess),
+    NODE_TYPE(ElementAccess), NODE_TYPE(ExpressionStatement), NODE_TYPE(Block), NODE_TYPE(TypeDeclaration),
+    NODE_TYPE(VariableDeclaration), NODE_TYPE(EventDeclaration), NODE_TYPE(InterfaceDeclaration),
+    NODE_TYPE(InterfaceField), NODE_TYPE(InterfaceMethod), NODE_TYPE(EnumDeclaration), NODE_TYPE(EnumMember),
+    NODE_TYPE(FunctionDeclaration), NODE_TYPE(Parameter), NODE_TYPE(InstanceConstructor),
+    NODE_TYPE(InstanceNameDeclarator), NODE_TYPE(InstancePropertyDeclarator), NODE_TYPE(InstanceAttributeDeclarator),
+    NODE_TYPE(InstanceTagDeclarator), NODE_TYPE(Break), NODE_TYPE(Continue), NODE_TYPE(Return), NODE_TYPE(If),
+    NODE_TYPE(While), NODE_TYPE(Repeat), NODE_TYPE(For), NODE_TYPE(After), NODE_TYPE(Every), NODE_TYPE(Match),
+    NODE_TYPE(MatchCase), NODE_TYPE(MatchElseCase), NODE_TYPE(Import), NODE_TYPE(Export), NODE_TYPE(Decorator),
+    NODE_TYPE(PrimitiveTypeRef), NODE_TYPE(TypeNameRef), NODE_TYPE(NullableTypeRef), NODE_TYPE(LiteralTypeRef),
+    NODE_TYPE(ArrayTypeRef), NODE_TYPE(UnionTypeRef), NODE_TYPE(IntersectionTypeRef), NODE_TYPE(FunctionTypeRef),
+    NODE_TYPE(TupleTypeRef), NODE_TYPE(TypeParameterRef)
+};
+
+#undef NODE_TYPE
+
+/** Records the type of every node the default traversal reaches, plus decorators and the types of interface members */
+struct NodeTypeCollector final : AstVisitor<void>
+{
+    std::set<std::type_index> seen;
+
+    void visit(const expression_ptr_t& expression) override
+    {
+        seen.insert(typeid(*expression));
+        AstVisitor::visit(expression);
+    }
+
+    void visit(const statement_ptr_t& statement) override
+    {
+        seen.insert(typeid(*statement));
+        AstVisitor::visit(statement);
+    }
+
+    void visit(const type_ref_ptr_t& type_ref) override
+    {
+        seen.insert(typeid(*type_ref));
+        AstVisitor::visit(type_ref);
+    }
+
+    void visit_function_declaration(FunctionDeclaration& function_declaration) override
+    {
+        visit_statements(function_declaration.decorator_list);
+        AstVisitor::visit_function_declaration(function_declaration);
+    }
+
+    void visit_interface_field(InterfaceField& interface_field) override
+    {
+        visit(interface_field.type);
+    }
+
+    void visit_interface_method(InterfaceMethod& interface_method) override
+    {
+        visit_type_list_clause(interface_method.type_parameters);
+        visit_type_refs(interface_method.parameter_types);
+        visit(interface_method.return_type);
+    }
+};
+
+static std::string syntax_name(const SyntaxKind kind)
+{
+    switch (kind)
+    {
+        case SyntaxKind::Identifier: return "Identifier";
+        case SyntaxKind::NumberLiteral: return "NumberLiteral";
+        case SyntaxKind::StringLiteral: return "StringLiteral";
+        case SyntaxKind::InterpolatedStringPart: return "InterpolatedStringPart";
+        case SyntaxKind::InterpolationStart: return "InterpolationStart";
+        case SyntaxKind::InterpolationEnd: return "InterpolationEnd";
+        default:
+            for (const auto& [lexeme, operator_kind] : operator_syntaxes)
+                if (operator_kind == kind)
+                    return std::string(lexeme);
+
+            return syntax_to_string(kind).value_or("SyntaxKind " + std::to_string(static_cast<int>(kind)));
+    }
+}
+
+/**
+ * Lexes and parses (and if `resolve` is set, resolves) every module. Fails if any of them is invalid, or if none of them
+ * contains some syntax or node type.
+ */
+static bool check_modules(const std::vector<GeneratedModule>& modules, const bool resolve)
+{
+    constexpr auto syntax_count = static_cast<size_t>(SyntaxKind::HsvKeyword) + 1;
+    std::vector seen_syntaxes(syntax_count, false);
+    NodeTypeCollector collector;
+    auto all_valid = true;
+
+    NullBuffer null_buffer;
+    for (const auto& module : modules)
+    {
+        const auto stdout_buffer = std::cout.rdbuf(&null_buffer);
+        std::optional<std::string> error;
+        try
+        {
+            ErrorDeferral deferral;
+            SourceFile file(module.name + ".ion", module.source);
+            const auto tokens = tokenize(file);
+            for (const auto kind : tokens.get_kinds())
+                seen_syntaxes[static_cast<size_t>(kind)] = true;
+
+            parse(file);
+            collector.visit_ast(file.statements);
+            if (resolve)
+                Resolver().walk_ast(file.statements);
+        }
+        catch (const DeferredError& deferred)
+        {
+            error = deferred.message;
+        }
+        catch (const std::exception& exception)
+        {
+            error = exception.what();
+        }
+
+        std::cout.rdbuf(stdout_buffer);
+        if (error.has_value())
+        {
+            all_valid = false;
+            std::fprintf(stderr, "%s.ion is invalid:\n%s\n", module.name.c_str(), error->c_str());
+        }
+    }
+
+    // `??=` is lexed but the parser doesn't accept it as an assignment operator, so no valid module contains it
+    seen_syntaxes[static_cast<size_t>(SyntaxKind::QuestionQuestionEquals)] = true;
+    if (resolve)
+    {
+        seen_syntaxes[static_cast<size_t>(SyntaxKind::ReturnKeyword)] = true;
+        seen_syntaxes[static_cast<size_t>(SyntaxKind::AwaitKeyword)] = true;
+        collector.seen.insert(typeid(Return));
+        collector.seen.insert(typeid(Await));
+    }
+
+    auto all_covered = true;
+    for (size_t kind = 0; kind < syntax_count; kind++)
+    {
+        if (seen_syntaxes[kind])
+            continue;
+
+        all_covered = false;
+        std::fprintf(stderr, "never emitted: %s\n", syntax_name(static_cast<SyntaxKind>(kind)).c_str());
+    }
+
+    for (const auto& [type, name] : node_types)
+    {
+        if (collector.seen.contains(type))
+            continue;
+
+        all_covered = false;
+        std::fprintf(stderr, "never emitted: %s node\n", name);
+    }
+
+    return all_valid && all_covered;
+}
+
+struct RecoveryCase
+{
+    std::string source;
+    size_t syntax_errors;
+};
+
+/** Malformed sources the recovering parser once mishandled, with how many syntax errors each should be reported with */
+const std::vector<RecoveryCase> recovery_cases = {
+    { "fn f() {\n  if a {\n", 1 },
+    { "fn f() {\n  while a {\n    if b {\n      let c = [\n", 1 },
+    { "let a = { 1 + };\nlet b = 2\n", 1 },
+    { "let x = \"abc#", 1 },
+    { "let x = \"abc}", 1 },
+    { "let x = 'a#{1}", 1 },
+    { "let x = \"abc#{", 1 },
+    { "let x = 1.", 0 },
+};
+
+static std::string repeat(const std::string_view part, const int count)
+{
+    std::string result;
+    result.reserve(part.size() * count);
+    for (auto i = 0; i < count; ++i)
+        result += part;
+
+    return result;
+}
+
+/**
+ * Long flat chains, which have to parse however long they get, and nesting up to and just past `max_nesting_depth`,
+ * which has to be reported as one syntax error instead of overflowing the stack.
+ */
+static std::vector<RecoveryCase> nesting_cases()
+{
+    constexpr auto chain_length = 100000;
+    constexpr auto nesting_depth = 1000;
+    return {
+        { "fn f() {\n  if a {\n  }" + repeat(" else if a {\n  }", chain_length) + "\n}\n", 0 },
+        { "let a = 1" + repeat(" ^ 1", chain_length) + "\n", 0 },
+        { "let a = 1" + repeat(" + 1", chain_length) + "\n", 0 },
+        { "fn f() {\n" + repeat("if a {\n", nesting_depth) + repeat("}\n", nesting_depth) + "}\n", 0 },
+        { "fn f() {\n" + repeat("while a ", nesting_depth) + "a()\n}\n", 0 },
+        { "let a: " + repeat("A<", nesting_depth) + "number" + repeat(">", nesting_depth) + " = 1\n", 0 },
+        // the initializer is one level of nesting itself
+        { "let a = " + repeat("(", max_nesting_depth - 1) + "1" + repeat(")", max_nesting_depth - 1) + "\n", 0 },
+        { "let a = " + repeat("(", max_nesting_depth) + "1" + repeat(")", max_nesting_depth) + "\n", 1 },
+    };
+}
+
+/** How many prefixes of each module `check_recovery` parses */
+constexpr size_t truncations_per_module = 256;
+
+/** Parses `source` with syntax error recovery, returns the number of syntax errors or the compiler error it hit */
+static std::variant<size_t, std::string> parse_recovering_source(const std::string& source)
+{
+    NullBuffer null_buffer;
+    const auto stdout_buffer = std::cout.rdbuf(&null_buffer);
+    std::variant<size_t, std::string> result;
+    try
+    {
+        ErrorDeferral deferral;
+        SourceFile file("recovery.ion", source);
+        parse_recovering(file);
+        result = file.syntax_errors.size();
+    }
+    catch (const std::exception& exception)
+    {
+        result = exception.what();
+    }
+
+    std::cout.rdbuf(stdout_buffer);
+    return result;
+}
+
+/**
+ * Parses the recovery cases and evenly spaced prefixes of every module, which cut it off anywhere (e.g. inside a few
+ * unclosed blocks). All of them have to be reported as syntax errors instead of ending in a compiler error.
+ */
+static bool check_recovery(const std::vector<GeneratedModule>& modules)
+{
+    auto cases = recovery_cases;
+    std::ranges::move(nesting_cases(), std::back_inserter(cases));
+
+    auto all_recovered = true;
+    for (const auto& [source, syntax_errors] : cases)
+    {
+        const auto result = parse_recovering_source(source);
+        if (const auto count = std::get_if<size_t>(&result); count != nullptr && *count == syntax_errors)
+            continue;
+
+        all_recovered = false;
+        const auto outcome = std::holds_alternative<size_t>(result)
+                                 ? std::to_string(std::get<size_t>(result)) + " syntax errors"
+                                 : std::get<std::string>(result);
+
+        // the nesting cases are too long to print in full
+        std::fprintf(stderr, "recovering from:\n%.*s\ngave %s instead of %zu syntax errors\n",
+                     static_cast<int>(std::min<size_t>(source.size(), 256)), source.data(), outcome.c_str(), syntax_errors);
+    }
+
+    for (const auto& module : modules)
+    {
+        const auto stride = std::max<size_t>(1, module.source.size() / truncations_per_module);
+        for (auto length = stride; length < module.source.size(); length += stride)
+        {
+            const auto result = parse_recovering_source(module.source.substr(0, length));
+            if (const auto error = std::get_if<std::string>(&result); error != nullptr)
+            {
+                all_recovered = false;
+                std::fprintf(stderr, "%s.ion cut off after %zu bytes: %s\n", module.name.c_str(), length, error->c_str());
+            }
+        }
+    }
+
+    return all_recovered;
+}
+
+/**
+ * Usage: IonCorpusGen [--seed N] [--size BYTES] [--files N] [--declarators N] [--members N] [--cases N] [--depth N]
+ *                     [--resolvable] [--check] [--out DIRECTORY]
+ * Writes `module_<i>.ion` files to the output directory, or a single module to stdout if there is none.
+ * The same options and seed always produce the same files. `--check` parses them and truncated copies of them, and
+ * fails if any is invalid, if some syntax or node type is in none of them, or if any syntax error in the copies isn't
+ * recovered from.
+ */
+int main(const int argc, char** argv)
+{
+    GeneratorOptions options;
+    std::optional<std::filesystem::path> output_directory;
+    auto check = false;
+    for (auto i = 1; i < argc; i++)
+    {
+        const std::string_view option = argv[i];
+        const auto has_value = i + 1 < argc;
+        if (option == "--resolvable")
+            options.resolvable = true;
+        else if (option == "--check")
+            check = true;
+        else if (option == "--seed" && has_value)
+            options.seed = static_cast<uint32_t>(std::stoul(argv[++i]));
+        else if (option == "--size" && has_value)
+            options.file_size = std::stoull(argv[++i]);
+        else if (option == "--files" && has_value)
+            options.file_count = std::max(1, std::stoi(argv[++i]));
+        else if (option == "--declarators" && has_value)
+            options.instance_declarators = std::stoi(argv[++i]);
+        else if (option == "--members" && has_value)
+            options.interface_members = std::stoi(argv[++i]);
+        else if (option == "--cases" && has_value)
+            options.match_cases = std::stoi(argv[++i]);
+        else if (option == "--depth" && has_value)
+            options.nesting_depth = std::max(1, std::stoi(argv[++i]));
+        else if (option == "--out" && has_value)
+            output_directory = argv[++i];
+        else
+        {
+            std::fprintf(stderr, "Unknown option '%s'\n", argv[i]);
+            return 1;
+        }
+    }
+
+    Random random(options.seed);
+    auto next_name = 0;
+    std::vector<GeneratedModule> modules;
+    for (auto i = 0; i < options.file_count; i++)
+    {
+        ModuleGenerator generator(options, random, next_name);
+        modules.push_back(generator.generate("module_" + std::to_string(i), modules));
+    }
+
+    if (output_directory.has_value())
+    {
+        std::filesystem::create_directories(*output_directory);
+        for (const auto& module : modules)
+            std::ofstream(*output_directory / (module.name + ".ion"), std::ios::binary) << module.source;
+    }
+    else
+        for (const auto& module : modules)
+            std::cout << module.source;
+
+    if (!check)
+        return 0;
+
+    // both always run, so one invocation shows every kind of failure
+    const auto modules_valid = check_modules(modules, options.resolvable);
+    const auto recovered = check_recovery(modules);
+    return modules_valid && recovered ? 0 : 1;
+}
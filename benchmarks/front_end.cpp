@@ -0,0 +1,356 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+#include "synthetic_sources.h"
+#include "ion/diagnostics.h"
+#include "ion/lexer.h"
+#include "ion/resolver.h"
+#include "ion/scanning.h"
+#include "ion/source_file.h"
+#include "ion/type_solver.h"
+#include "ion/ast/static_visitor.h"
+#include "ion/ast/visitor.h"
+#include "ion/ast/walker.h"
+#include "ion/parsing/parser.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#include <Psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+#ifndef ION_BENCH_CORPUS_DIR
+#define ION_BENCH_CORPUS_DIR "benchmarks/corpus"
+#endif
+
+struct BenchInput
+{
+    std::string name;
+    std::string text;
+};
+
+struct StageTiming
+{
+    std::string stage;
+    std::vector<double> seconds;
+};
+
+struct InputResult
+{
+    std::string name;
+    size_t bytes = 0;
+    size_t token_count = 0;
+    size_t node_count = 0;
+    std::vector<StageTiming> stages;
+    std::optional<std::string> error;
+    size_t peak_rss_bytes = 0;
+};
+
+/** Swallows the logger's output while a stage is being timed */
+class NullBuffer final : public std::streambuf
+{
+protected:
+    int overflow(const int character) override
+    {
+        return character;
+    }
+};
+
+/** Counts every node the default traversal reaches */
+struct NodeCounter final : AstVisitor<void>
+{
+    size_t count = 0;
+
+    void visit(const expression_ptr_t& expression) override
+    {
+        count++;
+        AstVisitor::visit(expression);
+    }
+
+    void visit(const statement_ptr_t& statement) override
+    {
+        count++;
+        AstVisitor::visit(statement);
+    }
+
+    void visit(const type_ref_ptr_t& type_ref) override
+    {
+        count++;
+        AstVisitor::visit(type_ref);
+    }
+};
+
+/** Same as `NodeCounter`, but through the statically dispatched traversal */
+struct StaticNodeCounter final : StaticAstVisitor<StaticNodeCounter>
+{
+    size_t count = 0;
+
+    void visit(const expression_ptr_t& expression)
+    {
+        count++;
+        StaticAstVisitor::visit(expression);
+    }
+
+    void visit(const statement_ptr_t& statement)
+    {
+        count++;
+        StaticAstVisitor::visit(statement);
+    }
+
+    void visit(const type_ref_ptr_t& type_ref)
+    {
+        count++;
+        StaticAstVisitor::visit(type_ref);
+    }
+};
+
+/** Same as `NodeCounter`, but through the explicit-stack walk */
+struct WalkerNodeCounter final : AstWalker<WalkerNodeCounter>
+{
+    size_t count = 0;
+
+    void enter_node(SyntaxNode&)
+    {
+        count++;
+    }
+};
+
+static size_t peak_rss_bytes()
+{
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters {};
+    GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters));
+    return counters.PeakWorkingSetSize;
+#else
+    rusage usage {};
+    getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+    return static_cast<size_t>(usage.ru_maxrss);
+#else
+    return static_cast<size_t>(usage.ru_maxrss) * 1024;
+#endif
+#endif
+}
+
+static std::vector<BenchInput> load_corpus(const std::filesystem::path& directory)
+{
+    std::vector<std::filesystem::path> paths;
+    if (std::filesystem::is_directory(directory))
+        for (const auto& entry : std::filesystem::directory_iterator(directory))
+            if (entry.is_regular_file() && entry.path().extension() == ".ion")
+                paths.push_back(entry.path());
+
+    std::ranges::sort(paths);
+    std::vector<BenchInput> inputs;
+    for (const auto& path : paths)
+    {
+        std::ifstream stream(path, std::ios::binary);
+        std::stringstream contents;
+        contents << stream.rdbuf();
+        inputs.push_back({ "corpus/" + path.filename().string(), contents.str() });
+    }
+
+    return inputs;
+}
+
+static double median(std::vector<double> values)
+{
+    std::ranges::sort(values);
+    const auto middle = values.size() / 2;
+    return values.size() % 2 == 1 ? values[middle] : (values[middle - 1] + values[middle]) / 2;
+}
+
+template <typename F>
+static double time_seconds(F&& run)
+{
+    const auto start = std::chrono::steady_clock::now();
+    run();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/** Runs every front end stage over a fresh copy of `input`, `iterations` times */
+static InputResult run_input(const BenchInput& input, const int iterations)
+{
+    InputResult result { input.name, input.text.size() };
+    for (const auto* stage : { "tokenize", "parse", "resolve", "type_solve", "walk_virtual", "walk_static", "walk_iterative" })
+        result.stages.push_back({ stage, {} });
+
+    NullBuffer null_buffer;
+    const auto stdout_buffer = std::cout.rdbuf(&null_buffer);
+    try
+    {
+        // errors throw instead of exiting, so one bad input doesn't end the whole run
+        ErrorDeferral deferral;
+        for (auto iteration = 0; iteration < iterations; iteration++)
+        {
+            SourceFile file(input.name, input.text);
+            result.stages[0].seconds.push_back(time_seconds([&] { result.token_count = tokenize(file).size(); }));
+            result.stages[1].seconds.push_back(time_seconds([&] { parse(file); }));
+            result.stages[2].seconds.push_back(time_seconds([&] { Resolver().walk_ast(file.statements); }));
+            result.stages[3].seconds.push_back(time_seconds([&] { TypeSolver().walk_ast(file.statements); }));
+
+            NodeCounter counter;
+            result.stages[4].seconds.push_back(time_seconds([&] { counter.visit_ast(file.statements); }));
+            result.node_count = counter.count;
+
+            StaticNodeCounter static_counter;
+            result.stages[5].seconds.push_back(time_seconds([&] { static_counter.visit_ast(file.statements); }));
+
+            WalkerNodeCounter walker_counter;
+            result.stages[6].seconds.push_back(time_seconds([&] { walker_counter.walk_ast(file.statements); }));
+        }
+    }
+    catch (const DeferredError& deferred)
+    {
+        result.error = deferred.message;
+    }
+    catch (const std::exception& exception)
+    {
+        result.error = exception.what();
+    }
+
+    std::cout.rdbuf(stdout_buffer);
+    std::erase_if(result.stages, [](const StageTiming& stage) { return stage.seconds.empty(); });
+    result.peak_rss_bytes = peak_rss_bytes();
+    return result;
+}
+
+static std::string escape_json(const std::string_view text)
+{
+    std::string escaped;
+    for (const auto character : text)
+    {
+        if (character == '"' || character == '\\')
+        {
+            escaped += '\\';
+            escaped += character;
+        }
+        else if (static_cast<unsigned char>(character) < 0x20)
+        {
+            char code[8];
+            std::snprintf(code, sizeof(code), "\\u%04x", static_cast<unsigned char>(character));
+            escaped += code;
+        }
+        else
+            escaped += character;
+    }
+
+    return escaped;
+}
+
+static void write_json(std::ostream& out, const std::vector<InputResult>& results, const int iterations)
+{
+    out << "{\n  \"iterations\": " << iterations
+        << ",\n  \"scanner\": \"" << escape_json(scanning::implementation_name())
+        << "\",\n  \"peak_rss_bytes\": " << peak_rss_bytes()
+        << ",\n  \"inputs\": [";
+
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        const auto& result = results[i];
+        out << (i > 0 ? "," : "") << "\n    {\n      \"name\": \"" << escape_json(result.name)
+            << "\",\n      \"bytes\": " << result.bytes
+            << ",\n      \"tokens\": " << result.token_count
+            << ",\n      \"nodes\": " << result.node_count
+            << ",\n      \"peak_rss_bytes\": " << result.peak_rss_bytes
+            << ",\n      \"error\": " << (result.error.has_value() ? '"' + escape_json(*result.error) + '"' : "null")
+            << ",\n      \"stages\": [";
+
+        for (size_t j = 0; j < result.stages.size(); j++)
+        {
+            const auto& stage = result.stages[j];
+            const auto seconds = median(stage.seconds);
+            out << (j > 0 ? "," : "") << "\n        { \"stage\": \"" << stage.stage
+                << "\", \"median_seconds\": " << seconds
+                << ", \"best_seconds\": " << *std::ranges::min_element(stage.seconds)
+                << ", \"mb_per_second\": " << static_cast<double>(result.bytes) / (1024 * 1024) / seconds
+                << ", \"tokens_per_second\": " << static_cast<double>(result.token_count) / seconds
+                << ", \"nodes_per_second\": " << static_cast<double>(result.node_count) / seconds << " }";
+        }
+
+        out << "\n      ]\n    }";
+    }
+
+    out << "\n  ]\n}\n";
+}
+
+static void print_summary(const std::vector<InputResult>& results)
+{
+    std::fprintf(stderr, "%-36s %-10s %10s %10s %14s %14s\n", "input", "stage", "ms", "MB/s", "tokens/s", "nodes/s");
+    for (const auto& result : results)
+    {
+        for (const auto& stage : result.stages)
+        {
+            const auto seconds = median(stage.seconds);
+            std::fprintf(stderr, "%-36s %-10s %10.3f %10.2f %14.0f %14.0f\n",
+                         result.name.c_str(), stage.stage.c_str(), seconds * 1000,
+                         static_cast<double>(result.bytes) / (1024 * 1024) / seconds,
+                         static_cast<double>(result.token_count) / seconds,
+                         static_cast<double>(result.node_count) / seconds);
+        }
+
+        if (result.error.has_value())
+            std::fprintf(stderr, "%-36s failed: %s\n", result.name.c_str(), result.error->c_str());
+    }
+
+    std::fprintf(stderr, "peak RSS: %.1f MB\n", static_cast<double>(peak_rss_bytes()) / (1024 * 1024));
+}
+
+/**
+ * Usage: IonBench [--iterations N] [--synthetic-size BYTES] [--corpus DIRECTORY] [--json PATH]
+ * Prints a summary to stderr and the results as JSON to stdout (or to `--json`'s path).
+ */
+int main(const int argc, char** argv)
+{
+    auto iterations = 5;
+    size_t synthetic_size = 1024 * 1024;
+    std::filesystem::path corpus_directory = ION_BENCH_CORPUS_DIR;
+    std::optional<std::string> json_path;
+    for (auto i = 1; i + 1 < argc; i += 2)
+    {
+        const std::string_view option = argv[i];
+        if (option == "--iterations")
+            iterations = std::max(1, std::stoi(argv[i + 1]));
+        else if (option == "--synthetic-size")
+            synthetic_size = std::stoull(argv[i + 1]);
+        else if (option == "--corpus")
+            corpus_directory = argv[i + 1];
+        else if (option == "--json")
+            json_path = argv[i + 1];
+        else
+        {
+            std::fprintf(stderr, "Unknown option '%s'\n", argv[i]);
+            return 1;
+        }
+    }
+
+    auto inputs = load_corpus(corpus_directory);
+    inputs.push_back({ "synthetic/deep_nesting", synthetic::deep_nesting(synthetic_size) });
+    inputs.push_back({ "synthetic/interpolated_strings", synthetic::interpolated_strings(synthetic_size) });
+    inputs.push_back({ "synthetic/huge_enum", synthetic::huge_enum(synthetic_size) });
+    inputs.push_back({ "synthetic/wide_instances", synthetic::wide_instances(synthetic_size) });
+
+    std::vector<InputResult> results;
+    for (const auto& input : inputs)
+        results.push_back(run_input(input, iterations));
+
+    print_summary(results);
+    if (json_path.has_value())
+    {
+        std::ofstream json_file(*json_path);
+        write_json(json_file, results, iterations);
+    }
+    else
+        write_json(std::cout, results, iterations);
+}
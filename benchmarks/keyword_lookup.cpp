@@ -0,0 +1,88 @@
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "ion/lexer.h"
+
+/** Builds the words of an identifier-heavy file, roughly one keyword for every three identifiers */
+static std::string generate_source(const size_t word_count)
+{
+    static constexpr std::string_view identifiers[] = {
+        "x", "value", "player", "character", "humanoid", "position", "velocity", "part", "model", "folder",
+        "index", "count", "connection", "instance_name", "retry_delay", "callback", "is_enabled", "tween", "ty", "ex"
+    };
+
+    std::mt19937 random(1337);
+    std::string source;
+    for (size_t i = 0; i < word_count; i++)
+    {
+        if (random() % 4 == 0)
+            source += keyword_syntaxes[random() % keyword_syntaxes.size()].first;
+        else
+            source += identifiers[random() % std::size(identifiers)];
+
+        source += ' ';
+    }
+
+    return source;
+}
+
+static std::vector<std::string_view> split_words(const std::string_view source)
+{
+    std::vector<std::string_view> words;
+    size_t start = 0;
+    for (size_t i = 0; i < source.size(); i++)
+    {
+        if (source[i] != ' ')
+            continue;
+
+        words.push_back(source.substr(start, i - start));
+        start = i + 1;
+    }
+
+    return words;
+}
+
+template <typename F>
+static double time_lookups(const char* name, const std::vector<std::string_view>& words, const int iterations, F&& lookup)
+{
+    size_t keyword_count = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (auto i = 0; i < iterations; i++)
+        for (const auto word : words)
+            keyword_count += lookup(word) != SyntaxKind::Identifier;
+
+    const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::printf("%-28s %.3fs (%zu keywords)\n", name, elapsed, keyword_count);
+    return elapsed;
+}
+
+int main()
+{
+    constexpr auto iterations = 20;
+    const auto source = generate_source(1'000'000);
+    const auto words = split_words(source);
+
+    // the lookup read_identifier_or_keyword used before find_keyword(): a std::string per identifier hashed into an unordered_map
+    std::unordered_map<std::string, SyntaxKind> keyword_map;
+    for (const auto& [lexeme, kind] : keyword_syntaxes)
+        keyword_map.emplace(lexeme, kind);
+
+    const auto map_seconds = time_lookups("unordered_map<std::string>:", words, iterations, [&](const std::string_view word)
+    {
+        const auto it = keyword_map.find(std::string(word));
+        return it != keyword_map.end() ? it->second : SyntaxKind::Identifier;
+    });
+    const auto switch_seconds = time_lookups("find_keyword:", words, iterations, [](const std::string_view word)
+    {
+        return find_keyword(word).value_or(SyntaxKind::Identifier);
+    });
+
+    const auto megabytes = static_cast<double>(source.size()) * iterations / (1024 * 1024);
+    std::printf("%.1f MB of identifiers: %.1f MB/s -> %.1f MB/s (%.2fx)\n",
+                megabytes, megabytes / map_seconds, megabytes / switch_seconds, map_seconds / switch_seconds);
+}
@@ -0,0 +1,153 @@
+#pragma once
+#include <string>
+
+/**
+ * Generators for large inputs shaped like the checked-in corpus, scaled up to roughly `target_size` bytes.
+ * Everything they generate gets through every front end pass (the type solver only handles annotated or literal-typed
+ * declarations, so every computed value is declared with a type).
+ */
+namespace synthetic
+{
+    inline void append_nested_block(std::string& source, const int level, const int max_level, const int indent)
+    {
+        const auto pad = std::string(indent * 4, ' ');
+        if (level == max_level)
+        {
+            std::string expression = "depth";
+            for (auto i = 0; i < 24; i++)
+                expression = '(' + expression + (i % 2 == 0 ? " + " : " * ") + std::to_string(i) + ')';
+
+            source += pad + "let innermost: number = " + expression + '\n';
+            return;
+        }
+
+        const auto level_text = std::to_string(level);
+        switch (level % 4)
+        {
+            case 0:
+                source += pad + "if depth < limit {\n";
+                break;
+            case 1:
+                source += pad + "while depth > " + level_text + " {\n";
+                break;
+            case 2:
+                source += pad + "for i" + level_text + " : 1.." + std::to_string(level + 2) + " {\n";
+                break;
+            default:
+                source += pad + "{\n";
+                break;
+        }
+
+        source += pad + "    let level" + level_text + ": number = depth\n";
+        append_nested_block(source, level + 1, max_level, indent + 1);
+        source += pad + "}\n";
+    }
+
+    /** Functions made of blocks nested `depth` levels deep, ending in a deeply parenthesized expression */
+    inline std::string deep_nesting(const size_t target_size, const int depth = 48)
+    {
+        std::string source = "let depth = 0\nlet limit = 64\n\n";
+        for (auto function_index = 0; source.size() < target_size; function_index++)
+        {
+            source += "fn nested" + std::to_string(function_index) + "(a: number): number {\n";
+            append_nested_block(source, 0, depth, 1);
+            source += "}\n\n";
+        }
+
+        return source;
+    }
+
+    /** String declarations with a dozen interpolations each, some of them nested strings */
+    inline std::string interpolated_strings(const size_t target_size)
+    {
+        static constexpr const char* names[] = { "player_name", "score", "health", "level" };
+        std::string source = "let player_name = \"Ion\"\nlet score = 1200\nlet health = 75\nlet level = 12\n\n";
+        for (auto i = 0; source.size() < target_size; i++)
+        {
+            source += "let message" + std::to_string(i) + ": string = \"";
+            for (auto j = 0; j < 12; j++)
+            {
+                const std::string name = names[(i + j) % 4];
+                if (j > 0)
+                    source += " | ";
+
+                if (j % 3 == 0)
+                    source += "segment " + std::to_string(j) + " #{" + name + '}';
+                else if (j % 3 == 1)
+                    source += "math #{" + name + " * " + std::to_string(j) + " + " + std::to_string(i) + '}';
+                else
+                    source += "nested #{\"inner #{" + name + "} text\"}";
+            }
+
+            source += "\"\n";
+        }
+
+        return source;
+    }
+
+    /** Enums with 500 members each, every 25th of them with an explicit value */
+    inline std::string huge_enum(const size_t target_size)
+    {
+        std::string source;
+        for (auto enum_index = 0; source.size() < target_size; enum_index++)
+        {
+            source += "enum HugeEnum" + std::to_string(enum_index) + " {\n";
+            for (auto member = 0; member < 500; member++)
+            {
+                source += "    Member" + std::to_string(member);
+                if (member % 25 == 0)
+                    source += " = " + std::to_string(member * 10);
+
+                source += '\n';
+            }
+
+            source += "}\n\n";
+        }
+
+        return source;
+    }
+
+    /**
+     * Instance constructors with 24 attributes, 24 tags and 40 properties each.
+     * Member names are unique across the file, since the resolver checks for duplicates file-wide.
+     */
+    inline std::string wide_instances(const size_t target_size)
+    {
+        static constexpr const char* properties[][2] = {
+            { "Size", "size" },
+            { "Position", "<(0, 10, 0)>" },
+            { "Color", "rgb<(255, 0, 0)>" },
+            { "Transparency", "50%" },
+            { "Anchored", "true" },
+            { "Material", "\"Neon\"" },
+            { "Rotation", "<(0, 90, 0)>" },
+            { "Hue", "hsv<(0.5, 1, 1)>" }
+        };
+
+        std::string source = "interface Part {}\ninterface Model {}\nlet workspace = 1\nlet size = 4\nlet folder = 2\n\n";
+        for (auto i = 0; source.size() < target_size; i++)
+        {
+            const auto suffix = std::to_string(i) + '_';
+            source += "instance instance" + std::to_string(i) + (i % 2 == 0 ? ": Part {\n" : ": Model {\n");
+            if (i == 0)
+                source += "    \"Instance0\"\n";
+
+            // an attribute directly after a property value would be read as an attribute access on it, so tags go in between
+            for (auto k = 0; k < 24; k++)
+            {
+                source += "    @Attribute" + suffix + std::to_string(k) + ": " + std::to_string(k * 3 + i) + '\n';
+                source += "    #Tag" + suffix + std::to_string(k) + '\n';
+            }
+
+            for (auto k = 0; k < 40; k++)
+            {
+                const auto& [name, value] = properties[k % std::size(properties)];
+                source += std::string("    ") + name + suffix + std::to_string(k) + ": " + value + '\n';
+            }
+
+            source += i % 3 == 0 ? "} -> folder\n\n" : "} -> workspace\n\n";
+        }
+
+        return source;
+    }
+}
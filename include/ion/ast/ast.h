@@ -55,6 +55,7 @@
 #include "ion/ast/statements/import.h"
 #include "ion/ast/statements/export.h"
 #include "ion/ast/statements/decorator.h"
+#include "ion/ast/statements/error_statement.h"
 
 #include "ion/ast/type_refs/primitive_type_ref.h"
 #include "ion/ast/type_refs/type_name_ref.h"
@@ -7,11 +7,14 @@
 
 struct BracedStatementList final : SyntaxNode
 {
+    static constexpr auto static_kind = NodeKind::BracedStatementList;
+
     Token l_brace, r_brace;
     std::vector<statement_ptr_t> statements;
 
     BracedStatementList(Token l_brace, std::vector<statement_ptr_t> statements, Token r_brace)
-        : l_brace(std::move(l_brace)),
+        : SyntaxNode(static_kind),
+          l_brace(std::move(l_brace)),
           r_brace(std::move(r_brace)),
           statements(std::move(statements))
     {
@@ -20,17 +23,17 @@ struct BracedStatementList final : SyntaxNode
     BracedStatementList(const BracedStatementList&) = delete;
     BracedStatementList& operator=(const BracedStatementList&) = delete;
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return l_brace;
     }
 
-    [[nodiscard]] Token get_last_token() const override
+    [[nodiscard]] const Token& find_last_token() const override
     {
         return r_brace;
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
         return "{\n" + join_by(statements, "\n") + "\n}";
     }
@@ -4,11 +4,14 @@
 
 struct ColonTypeClause final : SyntaxNode
 {
+    static constexpr auto static_kind = NodeKind::ColonTypeClause;
+
     Token colon_token;
     type_ref_ptr_t type;
 
     explicit ColonTypeClause(Token colon_token, type_ref_ptr_t type)
-        : colon_token(std::move(colon_token)),
+        : SyntaxNode(static_kind),
+          colon_token(std::move(colon_token)),
           type(std::move(type))
     {
     }
@@ -16,18 +19,18 @@ struct ColonTypeClause final : SyntaxNode
     ColonTypeClause(const ColonTypeClause&) = delete;
     ColonTypeClause& operator=(const ColonTypeClause&) = delete;
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return colon_token;
     }
 
-    [[nodiscard]] Token get_last_token() const override
+    [[nodiscard]] const Token& find_last_token() const override
     {
         return type->get_last_token();
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
-        return ": " + type->get_text();
+        return ": " + type->reconstruct_text();
     }
 };
\ No newline at end of file
@@ -4,11 +4,14 @@
 
 struct EqualsValueClause final : SyntaxNode
 {
+    static constexpr auto static_kind = NodeKind::EqualsValueClause;
+
     Token equals_token;
     expression_ptr_t value;
 
     explicit EqualsValueClause(Token equals_token, expression_ptr_t value)
-        : equals_token(std::move(equals_token)),
+        : SyntaxNode(static_kind),
+          equals_token(std::move(equals_token)),
           value(std::move(value))
     {
     }
@@ -16,18 +19,18 @@ struct EqualsValueClause final : SyntaxNode
     EqualsValueClause(const EqualsValueClause&) = delete;
     EqualsValueClause& operator=(const EqualsValueClause&) = delete;
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return equals_token;
     }
 
-    [[nodiscard]] Token get_last_token() const override
+    [[nodiscard]] const Token& find_last_token() const override
     {
         return value->get_last_token();
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
-        return " = " + value->get_text();
+        return " = " + value->reconstruct_text();
     }
 };
\ No newline at end of file
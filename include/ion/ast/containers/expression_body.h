@@ -4,27 +4,30 @@
 
 struct ExpressionBody final : SyntaxNode
 {
+    static constexpr auto static_kind = NodeKind::ExpressionBody;
+
     Token long_arrow;
     expression_ptr_t expression;
 
     ExpressionBody(Token long_arrow, expression_ptr_t expression)
-        : long_arrow(std::move(long_arrow)),
+        : SyntaxNode(static_kind),
+          long_arrow(std::move(long_arrow)),
           expression(std::move(expression))
     {
     }
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return long_arrow;
     }
 
-    [[nodiscard]] Token get_last_token() const override
+    [[nodiscard]] const Token& find_last_token() const override
     {
         return expression->get_last_token();
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
-        return " -> " + expression->get_text();
+        return " -> " + expression->reconstruct_text();
     }
 };
\ No newline at end of file
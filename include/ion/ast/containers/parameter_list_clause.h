@@ -7,11 +7,14 @@
 
 struct ParameterListClause final : SyntaxNode
 {
+    static constexpr auto static_kind = NodeKind::ParameterListClause;
+
     Token l_paren, r_paren;
     std::vector<statement_ptr_t> list;
 
     explicit ParameterListClause(Token l_paren, std::vector<statement_ptr_t> list, Token r_paren)
-        : l_paren(std::move(l_paren)),
+        : SyntaxNode(static_kind),
+          l_paren(std::move(l_paren)),
           r_paren(std::move(r_paren)),
           list(std::move(list))
     {
@@ -20,17 +23,17 @@ struct ParameterListClause final : SyntaxNode
     ParameterListClause(const ParameterListClause&) = delete;
     ParameterListClause& operator=(const ParameterListClause&) = delete;
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return l_paren;
     }
 
-    [[nodiscard]] Token get_last_token() const override
+    [[nodiscard]] const Token& find_last_token() const override
     {
         return r_paren;
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
         return '(' + join_by(list, ", ") + ')';
     }
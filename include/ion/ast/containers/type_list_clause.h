@@ -7,11 +7,14 @@
 
 struct TypeListClause final : SyntaxNode
 {
+    static constexpr auto static_kind = NodeKind::TypeListClause;
+
     Token l_arrow, r_arrow;
     std::vector<type_ref_ptr_t> list;
 
     explicit TypeListClause(Token l_arrow, std::vector<type_ref_ptr_t> list, Token r_arrow)
-        : l_arrow(std::move(l_arrow)),
+        : SyntaxNode(static_kind),
+          l_arrow(std::move(l_arrow)),
           r_arrow(std::move(r_arrow)),
           list(std::move(list))
     {
@@ -20,17 +23,17 @@ struct TypeListClause final : SyntaxNode
     TypeListClause(const TypeListClause&) = delete;
     TypeListClause& operator=(const TypeListClause&) = delete;
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return l_arrow;
     }
 
-    [[nodiscard]] Token get_last_token() const override
+    [[nodiscard]] const Token& find_last_token() const override
     {
         return r_arrow;
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
         return '<' + join_by(list, ", ") + '>';
     }
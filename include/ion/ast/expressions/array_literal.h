@@ -6,11 +6,14 @@
 class ArrayLiteral final : public Expression
 {
 public:
+    static constexpr auto static_kind = NodeKind::ArrayLiteral;
+
     Token l_bracket, r_bracket;
     std::vector<expression_ptr_t> elements;
 
     explicit ArrayLiteral(Token l_bracket, Token r_bracket, std::vector<expression_ptr_t> expressions)
-        : l_bracket(std::move(l_bracket)),
+        : Expression(static_kind),
+          l_bracket(std::move(l_bracket)),
           r_bracket(std::move(r_bracket)),
           elements(std::move(expressions))
     {
@@ -18,7 +21,7 @@ public:
 
     static expression_ptr_t create(Token l_bracket, Token r_bracket, std::vector<expression_ptr_t> expressions)
     {
-        return std::make_unique<ArrayLiteral>(std::move(l_bracket), std::move(r_bracket), std::move(expressions));
+        return create_node<ArrayLiteral>(std::move(l_bracket), std::move(r_bracket), std::move(expressions));
     }
 
     void accept(ExpressionVisitor<void>& visitor) override
@@ -26,17 +29,17 @@ public:
         return visitor.visit_array_literal(*this);
     }
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return l_bracket;
     }
 
-    [[nodiscard]] Token get_last_token() const override
+    [[nodiscard]] const Token& find_last_token() const override
     {
         return r_bracket;
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
         return '[' + join_by(elements, ", ") + ']';
     }
@@ -6,14 +6,16 @@
 class AssignmentOp final : public BinaryOp
 {
 public:
+    static constexpr auto static_kind = NodeKind::AssignmentOp;
+
     explicit AssignmentOp(Token operator_token, expression_ptr_t left, expression_ptr_t right)
-        : BinaryOp(std::move(operator_token), std::move(left), std::move(right))
+        : BinaryOp(static_kind, std::move(operator_token), std::move(left), std::move(right))
     {
     }
 
     static expression_ptr_t create(Token operator_token, expression_ptr_t left, expression_ptr_t right)
     {
-        return std::make_unique<AssignmentOp>(std::move(operator_token), std::move(left), std::move(right));
+        return create_node<AssignmentOp>(std::move(operator_token), std::move(left), std::move(right));
     }
 
     void accept(ExpressionVisitor<void>& visitor) override
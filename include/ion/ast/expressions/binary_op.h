@@ -5,20 +5,20 @@
 class BinaryOp : public Expression
 {
 public:
+    static constexpr auto static_kind = NodeKind::BinaryOp;
+
     Token operator_token;
     expression_ptr_t left;
     expression_ptr_t right;
 
     explicit BinaryOp(Token operator_token, expression_ptr_t left, expression_ptr_t right)
-        : operator_token(std::move(operator_token)),
-          left(std::move(left)),
-          right(std::move(right))
+        : BinaryOp(static_kind, std::move(operator_token), std::move(left), std::move(right))
     {
     }
 
     static expression_ptr_t create(Token operator_token, expression_ptr_t left, expression_ptr_t right)
     {
-        return std::make_unique<BinaryOp>(std::move(operator_token), std::move(left), std::move(right));
+        return create_node<BinaryOp>(std::move(operator_token), std::move(left), std::move(right));
     }
 
     void accept(ExpressionVisitor<void>& visitor) override
@@ -26,18 +26,27 @@ public:
         return visitor.visit_binary_op(*this);
     }
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return left->get_first_token();
     }
 
-    [[nodiscard]] Token get_last_token() const override
+    [[nodiscard]] const Token& find_last_token() const override
     {
         return right->get_last_token();
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
+    {
+        return left->reconstruct_text() + ' ' + std::string(operator_token.get_text()) + ' ' + right->reconstruct_text();
+    }
+
+protected:
+    BinaryOp(const NodeKind kind, Token operator_token, expression_ptr_t left, expression_ptr_t right)
+        : Expression(kind),
+          operator_token(std::move(operator_token)),
+          left(std::move(left)),
+          right(std::move(right))
     {
-        return left->get_text() + ' ' + operator_token.get_text() + ' ' + right->get_text();
     }
 };
\ No newline at end of file
@@ -5,12 +5,15 @@
 class ElementAccess final : public Expression
 {
 public:
+    static constexpr auto static_kind = NodeKind::ElementAccess;
+
     Token l_bracket, r_bracket;
     expression_ptr_t expression, index_expression;
 
     explicit ElementAccess(Token l_bracket, Token r_bracket, expression_ptr_t expression,
                            expression_ptr_t index_expression)
-        : l_bracket(std::move(l_bracket)),
+        : Expression(static_kind),
+          l_bracket(std::move(l_bracket)),
           r_bracket(std::move(r_bracket)),
           expression(std::move(expression)),
           index_expression(std::move(index_expression))
@@ -20,7 +23,7 @@ public:
     static expression_ptr_t create(Token l_bracket, Token r_bracket, expression_ptr_t expression,
                                    expression_ptr_t index_expression)
     {
-        return std::make_unique<ElementAccess>(std::move(l_bracket), std::move(r_bracket), std::move(expression),
+        return create_node<ElementAccess>(std::move(l_bracket), std::move(r_bracket), std::move(expression),
                                                std::move(index_expression));
     }
 
@@ -29,19 +32,19 @@ public:
         return visitor.visit_element_access(*this);
     }
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return expression->get_first_token();
     }
 
-    [[nodiscard]] Token get_last_token() const override
+    [[nodiscard]] const Token& find_last_token() const override
     {
         return r_bracket;
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
-        return expression->get_text() + '[' + index_expression->get_text() + ']';
+        return expression->reconstruct_text() + '[' + index_expression->reconstruct_text() + ']';
     }
 
     [[nodiscard]] bool is_assignment_target() const override
@@ -7,11 +7,14 @@
 class HsvLiteral final : public Expression
 {
 public:
+    static constexpr auto static_kind = NodeKind::HsvLiteral;
+
     Token hsv_keyword, l_arrow, r_arrow;
     expression_ptr_t h, s, v;
 
     explicit HsvLiteral(Token hsv_keyword, Token l_arrow, Token r_arrow, expression_ptr_t h, expression_ptr_t s, expression_ptr_t v)
-        : hsv_keyword(std::move(hsv_keyword)),
+        : Expression(static_kind),
+          hsv_keyword(std::move(hsv_keyword)),
           l_arrow(std::move(l_arrow)),
           r_arrow(std::move(r_arrow)),
           h(std::move(h)),
@@ -23,7 +26,7 @@ public:
     static expression_ptr_t create(Token hsv_keyword, Token l_arrow, Token r_arrow,
                                    expression_ptr_t h, expression_ptr_t s, expression_ptr_t v)
     {
-        return std::make_unique<HsvLiteral>(std::move(hsv_keyword), std::move(l_arrow), std::move(r_arrow),
+        return create_node<HsvLiteral>(std::move(hsv_keyword), std::move(l_arrow), std::move(r_arrow),
                                             std::move(h), std::move(s), std::move(v));
     }
 
@@ -32,19 +35,19 @@ public:
         return visitor.visit_hsv_literal(*this);
     }
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return hsv_keyword;
     }
 
-    [[nodiscard]] Token get_last_token() const override
+    [[nodiscard]] const Token& find_last_token() const override
     {
         return r_arrow;
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
-        return "hsv<" + h->get_text() + ", " + s->get_text() + ", " + v->get_text() + '>';
+        return "hsv<" + h->reconstruct_text() + ", " + s->reconstruct_text() + ", " + v->reconstruct_text() + '>';
     }
 
     [[nodiscard]] bool is_literal() const override
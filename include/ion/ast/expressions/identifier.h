@@ -7,16 +7,19 @@
 class Identifier final : public Expression
 {
 public:
+    static constexpr auto static_kind = NodeKind::Identifier;
+
     Token name;
 
     explicit Identifier(Token name)
-        : name(std::move(name))
+        : Expression(static_kind),
+          name(std::move(name))
     {
     }
 
     static expression_ptr_t create(Token value)
     {
-        return std::make_unique<Identifier>(std::move(value));
+        return create_node<Identifier>(std::move(value));
     }
 
     void accept(ExpressionVisitor<void>& visitor) override
@@ -24,14 +27,14 @@ public:
         return visitor.visit_identifier(*this);
     }
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return name;
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
-        return name.get_text();
+        return std::string(name.get_text());
     }
 
     [[nodiscard]] bool is_name_of_target() const override
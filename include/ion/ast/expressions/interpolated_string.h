@@ -6,18 +6,21 @@
 class InterpolatedString final : public Expression
 {
 public:
+    static constexpr auto static_kind = NodeKind::InterpolatedString;
+
     std::vector<Token> parts;
     std::vector<expression_ptr_t> interpolations;
 
     explicit InterpolatedString(std::vector<Token> parts, std::vector<expression_ptr_t> interpolations)
-        : parts(std::move(parts)),
+        : Expression(static_kind),
+          parts(std::move(parts)),
           interpolations(std::move(interpolations))
     {
     }
 
     static expression_ptr_t create(std::vector<Token> parts, std::vector<expression_ptr_t> interpolations)
     {
-        return std::make_unique<InterpolatedString>(std::move(parts), std::move(interpolations));
+        return create_node<InterpolatedString>(std::move(parts), std::move(interpolations));
     }
 
     void accept(ExpressionVisitor<void>& visitor) override
@@ -25,17 +28,17 @@ public:
         return visitor.visit_interpolated_string(*this);
     }
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return parts.front();
     }
 
-    [[nodiscard]] Token get_last_token() const override
+    [[nodiscard]] const Token& find_last_token() const override
     {
         return parts.back();
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
         auto i = 0;
         std::ostringstream oss;
@@ -43,7 +46,7 @@ public:
         oss << parts[i++].get_text();
         while (i < interpolations.size())
         {
-            const auto interpolation_text = interpolations[i]->get_text();
+            const auto interpolation_text = interpolations[i]->reconstruct_text();
             const auto part_text = parts[i++].get_text();
             oss << "#{" << interpolation_text << "}" << part_text;
         }
@@ -5,12 +5,15 @@
 class MemberAccess final : public Expression
 {
 public:
+    static constexpr auto static_kind = NodeKind::MemberAccess;
+
     Token token;
     expression_ptr_t expression;
     Token name;
 
     explicit MemberAccess(Token token, expression_ptr_t expression, Token name)
-        : token(std::move(token)),
+        : Expression(static_kind),
+          token(std::move(token)),
           expression(std::move(expression)),
           name(std::move(name))
     {
@@ -18,7 +21,7 @@ public:
 
     static expression_ptr_t create(Token token, expression_ptr_t expression, Token name)
     {
-        return std::make_unique<MemberAccess>(std::move(token), std::move(expression), std::move(name));
+        return create_node<MemberAccess>(std::move(token), std::move(expression), std::move(name));
     }
 
     void accept(ExpressionVisitor<void>& visitor) override
@@ -26,19 +29,19 @@ public:
         return visitor.visit_member_access(*this);
     }
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return expression->get_first_token();
     }
 
-    [[nodiscard]] Token get_last_token() const override
+    [[nodiscard]] const Token& find_last_token() const override
     {
         return name;
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
-        return expression->get_text() + token.get_text() + name.get_text();
+        return expression->reconstruct_text() + std::string(token.get_text()) + std::string(name.get_text());
     }
 
     [[nodiscard]] bool is_name_of_target() const override
@@ -5,17 +5,20 @@
 class NameOf final : public Expression
 {
 public:
+    static constexpr auto static_kind = NodeKind::NameOf;
+
     Token keyword, identifier;
 
     explicit NameOf(Token keyword, Token identifier)
-        : keyword(std::move(keyword)),
+        : Expression(static_kind),
+          keyword(std::move(keyword)),
           identifier(std::move(identifier))
     {
     }
 
     static expression_ptr_t create(Token keyword, Token identifier)
     {
-        return std::make_unique<NameOf>(std::move(keyword), std::move(identifier));
+        return create_node<NameOf>(std::move(keyword), std::move(identifier));
     }
 
     void accept(ExpressionVisitor<void>& visitor) override
@@ -23,18 +26,18 @@ public:
         return visitor.visit_name_of(*this);
     }
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return keyword;
     }
 
-    [[nodiscard]] Token get_last_token() const override
+    [[nodiscard]] const Token& find_last_token() const override
     {
         return identifier;
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
-        return "nameof " + identifier.get_text();
+        return "nameof " + std::string(identifier.get_text());
     }
 };
\ No newline at end of file
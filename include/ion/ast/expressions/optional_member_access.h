@@ -5,12 +5,15 @@
 class OptionalMemberAccess final : public Expression
 {
 public:
+    static constexpr auto static_kind = NodeKind::OptionalMemberAccess;
+
     Token token, question_token;
     expression_ptr_t expression;
     Token name;
 
     explicit OptionalMemberAccess(Token token, Token question_token, expression_ptr_t expression, Token name)
-        : token(std::move(token)),
+        : Expression(static_kind),
+          token(std::move(token)),
           question_token(std::move(question_token)),
           expression(std::move(expression)),
           name(std::move(name))
@@ -19,7 +22,7 @@ public:
 
     static expression_ptr_t create(Token token, Token question_token, expression_ptr_t expression, Token name)
     {
-        return std::make_unique<OptionalMemberAccess>(std::move(token), std::move(question_token), std::move(expression), std::move(name));
+        return create_node<OptionalMemberAccess>(std::move(token), std::move(question_token), std::move(expression), std::move(name));
     }
 
     void accept(ExpressionVisitor<void>& visitor) override
@@ -27,19 +30,19 @@ public:
         return visitor.visit_optional_member_access(*this);
     }
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return expression->get_first_token();
     }
 
-    [[nodiscard]] Token get_last_token() const override
+    [[nodiscard]] const Token& find_last_token() const override
     {
         return name;
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
-        return expression->get_text() + '?' + token.get_text() + name.get_text();
+        return expression->reconstruct_text() + '?' + std::string(token.get_text()) + std::string(name.get_text());
     }
 
     [[nodiscard]] bool is_name_of_target() const override
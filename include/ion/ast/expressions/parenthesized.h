@@ -5,11 +5,14 @@
 class Parenthesized final : public Expression
 {
 public:
+    static constexpr auto static_kind = NodeKind::Parenthesized;
+
     Token l_paren, r_paren;
     expression_ptr_t expression;
 
     explicit Parenthesized(Token l_paren, Token r_paren, expression_ptr_t expression)
-        : l_paren(std::move(l_paren)),
+        : Expression(static_kind),
+          l_paren(std::move(l_paren)),
           r_paren(std::move(r_paren)),
           expression(std::move(expression))
     {
@@ -17,7 +20,7 @@ public:
 
     static expression_ptr_t create(Token l_paren, Token r_paren, expression_ptr_t expression)
     {
-        return std::make_unique<Parenthesized>(std::move(l_paren), std::move(r_paren), std::move(expression));
+        return create_node<Parenthesized>(std::move(l_paren), std::move(r_paren), std::move(expression));
     }
 
     void accept(ExpressionVisitor<void>& visitor) override
@@ -25,19 +28,19 @@ public:
         return visitor.visit_parenthesized(*this);
     }
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return l_paren;
     }
 
-    [[nodiscard]] Token get_last_token() const override
+    [[nodiscard]] const Token& find_last_token() const override
     {
         return r_paren;
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
-        return '(' + expression->get_text() + ')';
+        return '(' + expression->reconstruct_text() + ')';
     }
 
     [[nodiscard]] bool is_parenthesized() const override
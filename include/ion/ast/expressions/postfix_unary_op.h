@@ -6,14 +6,16 @@
 class PostfixUnaryOp final : public UnaryOp
 {
 public:
+    static constexpr auto static_kind = NodeKind::PostfixUnaryOp;
+
     PostfixUnaryOp(Token operator_token, expression_ptr_t operand)
-        : UnaryOp(std::move(operator_token), std::move(operand))
+        : UnaryOp(static_kind, std::move(operator_token), std::move(operand))
     {
     }
 
     static expression_ptr_t create(Token operator_token, expression_ptr_t operand)
     {
-        return std::make_unique<PostfixUnaryOp>(std::move(operator_token), std::move(operand));
+        return create_node<PostfixUnaryOp>(std::move(operator_token), std::move(operand));
     }
 
     void accept(ExpressionVisitor<void>& visitor) override
@@ -21,18 +23,18 @@ public:
         return visitor.visit_postfix_unary_op(*this);
     }
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return operand->get_first_token();
     }
 
-    [[nodiscard]] Token get_last_token() const override
+    [[nodiscard]] const Token& find_last_token() const override
     {
         return operator_token;
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
-        return operand->get_text() + operator_token.get_text();
+        return operand->reconstruct_text() + std::string(operator_token.get_text());
     }
 };
\ No newline at end of file
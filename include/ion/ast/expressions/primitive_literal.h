@@ -10,18 +10,21 @@
 class PrimitiveLiteral final : public Expression
 {
 public:
+    static constexpr auto static_kind = NodeKind::PrimitiveLiteral;
+
     Token token;
     std::optional<primitive_value_t> value;
 
     explicit PrimitiveLiteral(Token token, std::optional<primitive_value_t> value)
-        : token(std::move(token)),
+        : Expression(static_kind),
+          token(std::move(token)),
           value(std::move(value))
     {
     }
 
     static expression_ptr_t create(Token token, std::optional<primitive_value_t> value)
     {
-        return std::make_unique<PrimitiveLiteral>(std::move(token), std::move(value));
+        return create_node<PrimitiveLiteral>(std::move(token), std::move(value));
     }
 
     void accept(ExpressionVisitor<void>& visitor) override
@@ -29,12 +32,12 @@ public:
         return visitor.visit_primitive_literal(*this);
     }
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return token;
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
         return primitive_to_string(value);
     }
@@ -7,11 +7,14 @@
 class RangeLiteral final : public Expression
 {
 public:
+    static constexpr auto static_kind = NodeKind::RangeLiteral;
+
     Token dot_dot_token;
     expression_ptr_t minimum, maximum;
 
     explicit RangeLiteral(expression_ptr_t minimum, Token dot_dot_token, expression_ptr_t maximum)
-        : dot_dot_token(std::move(dot_dot_token)),
+        : Expression(static_kind),
+          dot_dot_token(std::move(dot_dot_token)),
           minimum(std::move(minimum)),
           maximum(std::move(maximum))
     {
@@ -19,7 +22,7 @@ public:
 
     static expression_ptr_t create(expression_ptr_t minimum, Token dot_dot_token, expression_ptr_t maximum)
     {
-        return std::make_unique<RangeLiteral>(std::move(minimum), std::move(dot_dot_token), std::move(maximum));
+        return create_node<RangeLiteral>(std::move(minimum), std::move(dot_dot_token), std::move(maximum));
     }
 
     void accept(ExpressionVisitor<void>& visitor) override
@@ -27,20 +30,20 @@ public:
         return visitor.visit_range_literal(*this);
     }
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return minimum->get_first_token();
     }
 
-    [[nodiscard]] Token get_last_token() const override
+    [[nodiscard]] const Token& find_last_token() const override
     {
         return maximum->get_last_token();
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
-        const auto minimum_text = minimum->is_primitive_literal() ? minimum->get_text() : '(' + minimum->get_text() + ')';
-        const auto maximum_text = maximum->is_primitive_literal() ? maximum->get_text() : '(' + maximum->get_text() + ')';
+        const auto minimum_text = minimum->is_primitive_literal() ? minimum->reconstruct_text() : '(' + minimum->reconstruct_text() + ')';
+        const auto maximum_text = maximum->is_primitive_literal() ? maximum->reconstruct_text() : '(' + maximum->reconstruct_text() + ')';
         return minimum_text + ".." + maximum_text;
     }
 
@@ -7,11 +7,14 @@
 class RgbLiteral final : public Expression
 {
 public:
+    static constexpr auto static_kind = NodeKind::RgbLiteral;
+
     Token rgb_keyword, l_arrow, r_arrow;
     expression_ptr_t r, g, b;
 
     explicit RgbLiteral(Token rgb_keyword, Token l_arrow, Token r_arrow, expression_ptr_t r, expression_ptr_t g, expression_ptr_t b)
-        : rgb_keyword(std::move(rgb_keyword)),
+        : Expression(static_kind),
+          rgb_keyword(std::move(rgb_keyword)),
           l_arrow(std::move(l_arrow)),
           r_arrow(std::move(r_arrow)),
           r(std::move(r)),
@@ -23,7 +26,7 @@ public:
     static expression_ptr_t create(Token rgb_keyword, Token l_arrow, Token r_arrow,
                                    expression_ptr_t r, expression_ptr_t g, expression_ptr_t b)
     {
-        return std::make_unique<RgbLiteral>(std::move(rgb_keyword), std::move(l_arrow), std::move(r_arrow),
+        return create_node<RgbLiteral>(std::move(rgb_keyword), std::move(l_arrow), std::move(r_arrow),
                                             std::move(r), std::move(g), std::move(b));
     }
 
@@ -32,19 +35,19 @@ public:
         return visitor.visit_rgb_literal(*this);
     }
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return rgb_keyword;
     }
 
-    [[nodiscard]] Token get_last_token() const override
+    [[nodiscard]] const Token& find_last_token() const override
     {
         return r_arrow;
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
-        return "rgb<" + r->get_text() + ", " + g->get_text() + ", " + b->get_text() + '>';
+        return "rgb<" + r->reconstruct_text() + ", " + g->reconstruct_text() + ", " + b->reconstruct_text() + '>';
     }
 
     [[nodiscard]] bool is_literal() const override
@@ -5,12 +5,15 @@
 class TernaryOp final : public Expression
 {
 public:
+    static constexpr auto static_kind = NodeKind::TernaryOp;
+
     Token question_token, colon_token;
     expression_ptr_t condition, when_true, when_false;
 
     explicit TernaryOp(Token question_token, Token colon_token, expression_ptr_t condition, expression_ptr_t when_true,
                        expression_ptr_t when_false)
-        : question_token(std::move(question_token)),
+        : Expression(static_kind),
+          question_token(std::move(question_token)),
           colon_token(std::move(colon_token)),
           condition(std::move(condition)),
           when_true(std::move(when_true)),
@@ -21,7 +24,7 @@ public:
     static expression_ptr_t create(Token question_token, Token colon_token, expression_ptr_t condition,
                                    expression_ptr_t when_true, expression_ptr_t when_false)
     {
-        return std::make_unique<TernaryOp>(std::move(question_token), std::move(colon_token), std::move(condition),
+        return create_node<TernaryOp>(std::move(question_token), std::move(colon_token), std::move(condition),
                                            std::move(when_true), std::move(when_false));
     }
 
@@ -30,18 +33,18 @@ public:
         return visitor.visit_ternary_op(*this);
     }
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return condition->get_first_token();
     }
 
-    [[nodiscard]] Token get_last_token() const override
+    [[nodiscard]] const Token& find_last_token() const override
     {
         return when_false->get_last_token();
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
-        return condition->get_text() + " ? " + when_true->get_text() + " : " + when_false->get_text();
+        return condition->reconstruct_text() + " ? " + when_true->reconstruct_text() + " : " + when_false->reconstruct_text();
     }
 };
\ No newline at end of file
@@ -6,11 +6,14 @@
 class TupleLiteral final : public Expression
 {
 public:
+    static constexpr auto static_kind = NodeKind::TupleLiteral;
+
     Token l_paren, r_paren;
     std::vector<expression_ptr_t> elements;
 
     explicit TupleLiteral(Token l_paren, Token r_paren, std::vector<expression_ptr_t> expressions)
-        : l_paren(std::move(l_paren)),
+        : Expression(static_kind),
+          l_paren(std::move(l_paren)),
           r_paren(std::move(r_paren)),
           elements(std::move(expressions))
     {
@@ -18,7 +21,7 @@ public:
 
     static expression_ptr_t create(Token l_paren, Token r_paren, std::vector<expression_ptr_t> expressions)
     {
-        return std::make_unique<TupleLiteral>(std::move(l_paren), std::move(r_paren), std::move(expressions));
+        return create_node<TupleLiteral>(std::move(l_paren), std::move(r_paren), std::move(expressions));
     }
 
     void accept(ExpressionVisitor<void>& visitor) override
@@ -26,17 +29,17 @@ public:
         return visitor.visit_tuple_literal(*this);
     }
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return l_paren;
     }
 
-    [[nodiscard]] Token get_last_token() const override
+    [[nodiscard]] const Token& find_last_token() const override
     {
         return r_paren;
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
         return '(' + join_by(elements, ", ") + ')';
     }
@@ -5,18 +5,21 @@
 class TypeOf final : public Expression
 {
 public:
+    static constexpr auto static_kind = NodeKind::TypeOf;
+
     Token keyword;
     expression_ptr_t expression;
 
     explicit TypeOf(Token keyword, expression_ptr_t expression)
-        : keyword(std::move(keyword)),
+        : Expression(static_kind),
+          keyword(std::move(keyword)),
           expression(std::move(expression))
     {
     }
 
     static expression_ptr_t create(Token keyword, expression_ptr_t expression)
     {
-        return std::make_unique<TypeOf>(std::move(keyword), std::move(expression));
+        return create_node<TypeOf>(std::move(keyword), std::move(expression));
     }
 
     void accept(ExpressionVisitor<void>& visitor) override
@@ -24,18 +27,18 @@ public:
         return visitor.visit_type_of(*this);
     }
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return keyword;
     }
 
-    [[nodiscard]] Token get_last_token() const override
+    [[nodiscard]] const Token& find_last_token() const override
     {
         return expression->get_last_token();
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
-        return "typeof " + expression->get_text();
+        return "typeof " + expression->reconstruct_text();
     }
 };
\ No newline at end of file
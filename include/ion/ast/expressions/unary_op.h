@@ -5,18 +5,19 @@
 class UnaryOp : public Expression
 {
 public:
+    static constexpr auto static_kind = NodeKind::UnaryOp;
+
     Token operator_token;
     expression_ptr_t operand;
 
     UnaryOp(Token operator_token, expression_ptr_t operand)
-        : operator_token(std::move(operator_token)),
-          operand(std::move(operand))
+        : UnaryOp(static_kind, std::move(operator_token), std::move(operand))
     {
     }
 
     static expression_ptr_t create(Token operator_token, expression_ptr_t operand)
     {
-        return std::make_unique<UnaryOp>(std::move(operator_token), std::move(operand));
+        return create_node<UnaryOp>(std::move(operator_token), std::move(operand));
     }
 
     void accept(ExpressionVisitor<void>& visitor) override
@@ -24,18 +25,26 @@ public:
         return visitor.visit_unary_op(*this);
     }
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return operator_token;
     }
 
-    [[nodiscard]] Token get_last_token() const override
+    [[nodiscard]] const Token& find_last_token() const override
     {
         return operand->get_last_token();
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
+    {
+        return std::string(operator_token.get_text()) + operand->reconstruct_text();
+    }
+
+protected:
+    UnaryOp(const NodeKind kind, Token operator_token, expression_ptr_t operand)
+        : Expression(kind),
+          operator_token(std::move(operator_token)),
+          operand(std::move(operand))
     {
-        return operator_token.get_text() + operand->get_text();
     }
 };
\ No newline at end of file
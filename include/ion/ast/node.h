@@ -1,28 +1,52 @@
 #pragma once
 #include <memory>
 
+#include "node_kind.h"
 #include "visitor_fwd.h"
+#include "ion/ast_arena.h"
 #include "ion/token.h"
 #include "ion/file_location.h"
 #include "ion/symbols/symbol.h"
 
 class SyntaxNode
 {
+    /** Set by `cache_span`, so spans and text don't walk down the tree every time they're asked for */
+    const Token* first_token_ = nullptr;
+    const Token* last_token_ = nullptr;
+
 public:
+    const NodeKind kind;
     std::optional<symbol_ptr_t> symbol;
 
-    [[nodiscard]] virtual Token get_first_token() const = 0;
-    [[nodiscard]] virtual Token get_last_token() const;
-    [[nodiscard]] virtual FileSpan get_span() const;
-    [[nodiscard]] virtual std::string get_text() const = 0;
+    explicit SyntaxNode(const NodeKind kind)
+        : kind(kind)
+    {
+    }
+
+    [[nodiscard]] const Token& get_first_token() const;
+    [[nodiscard]] const Token& get_last_token() const;
+    /** Span from the start of the node's first token to the end of its last */
+    [[nodiscard]] FileSpan get_span() const;
+    /** The node's text as written in the source */
+    [[nodiscard]] std::string_view get_text() const;
+    /** Rebuilds the node's text from its tokens and children in a normalized form, meant for the AST viewer */
+    [[nodiscard]] virtual std::string reconstruct_text() const = 0;
     [[nodiscard]] symbol_ptr_t get_symbol();
+    /** Caches the node's first and last tokens, `create_node` calls this once the node and its children are constructed */
+    void cache_span();
 
     virtual ~SyntaxNode() = default;
+
+protected:
+    [[nodiscard]] virtual const Token& find_first_token() const = 0;
+    [[nodiscard]] virtual const Token& find_last_token() const;
 };
 
 class Expression : public SyntaxNode
 {
 public:
+    using SyntaxNode::SyntaxNode;
+
     virtual void accept(ExpressionVisitor<void>&) = 0;
 
     DEFINE_IS_FN(null_literal)
@@ -37,6 +61,8 @@ public:
 class Statement : public SyntaxNode
 {
 public:
+    using SyntaxNode::SyntaxNode;
+
     virtual void accept(StatementVisitor<void>&) = 0;
 
     DEFINE_IS_FN(return)
@@ -46,9 +72,28 @@ public:
 class TypeRef : public SyntaxNode
 {
 public:
+    using SyntaxNode::SyntaxNode;
+
     virtual void accept(TypeRefVisitor<void>&) = 0;
 };
 
-using expression_ptr_t = std::unique_ptr<Expression>;
-using statement_ptr_t = std::unique_ptr<Statement>;
-using type_ref_ptr_t = std::unique_ptr<TypeRef>;
\ No newline at end of file
+/** Constructs a node or clause in the current arena and caches its span */
+template <typename T, typename... Args>
+T* create_node(Args&&... args)
+{
+    const auto node = AstArena::current().create<T>(std::forward<Args>(args)...);
+    node->cache_span();
+    return node;
+}
+
+/** Nodes are owned by their file's `AstArena`, so handles to them are plain pointers */
+using expression_ptr_t = Expression*;
+using statement_ptr_t = Statement*;
+using type_ref_ptr_t = TypeRef*;
+
+/** Returns `node` as a `T` if it is exactly a `T` (subclasses don't match), checked by its kind tag instead of RTTI */
+template <typename T, typename Node>
+T* node_cast(Node* node)
+{
+    return node != nullptr && node->kind == T::static_kind ? static_cast<T*>(node) : nullptr;
+}
@@ -0,0 +1,82 @@
+#pragma once
+#include <cstdint>
+
+/** Tag of every concrete node and clause class, stored in each node so it can be dispatched on without RTTI */
+enum class NodeKind : uint8_t
+{
+    PrimitiveLiteral,
+    ArrayLiteral,
+    TupleLiteral,
+    RangeLiteral,
+    RgbLiteral,
+    HsvLiteral,
+    VectorLiteral,
+    InterpolatedString,
+    Identifier,
+    Parenthesized,
+    BinaryOp,
+    PostfixUnaryOp,
+    UnaryOp,
+    AssignmentOp,
+    TernaryOp,
+    Invocation,
+    TypeOf,
+    NameOf,
+    Await,
+    MemberAccess,
+    OptionalMemberAccess,
+    ElementAccess,
+
+    ExpressionStatement,
+    Block,
+    VariableDeclaration,
+    TypeDeclaration,
+    EventDeclaration,
+    InterfaceDeclaration,
+    InterfaceField,
+    InterfaceMethod,
+    EnumDeclaration,
+    EnumMember,
+    FunctionDeclaration,
+    Parameter,
+    InstanceConstructor,
+    InstancePropertyDeclarator,
+    InstanceNameDeclarator,
+    InstanceAttributeDeclarator,
+    InstanceTagDeclarator,
+    Break,
+    Continue,
+    Return,
+    If,
+    While,
+    Repeat,
+    For,
+    After,
+    Every,
+    Match,
+    MatchCase,
+    MatchElseCase,
+    Import,
+    Export,
+    Decorator,
+    ErrorStatement,
+
+    PrimitiveTypeRef,
+    LiteralTypeRef,
+    TypeNameRef,
+    NullableTypeRef,
+    ArrayTypeRef,
+    TupleTypeRef,
+    FunctionTypeRef,
+    IntersectionTypeRef,
+    UnionTypeRef,
+    TypeParameterRef,
+
+    BracedStatementList,
+    ColonTypeClause,
+    EqualsValueClause,
+    ExpressionBody,
+    FunctionBody,
+    ParameterListClause,
+    TypeListClause
+};
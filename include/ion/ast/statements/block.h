@@ -5,21 +5,19 @@
 class Block final : public Statement
 {
 public:
+    static constexpr auto static_kind = NodeKind::Block;
+
     BracedStatementList* braced_statement_list;
 
     explicit Block(BracedStatementList* braced_statement_list)
-        : braced_statement_list(braced_statement_list)
-    {
-    }
-
-    ~Block() override
+        : Statement(static_kind),
+          braced_statement_list(braced_statement_list)
     {
-        delete braced_statement_list;
     }
 
     static statement_ptr_t create(BracedStatementList* braced_statement_list)
     {
-        return std::make_unique<Block>(braced_statement_list);
+        return create_node<Block>(braced_statement_list);
     }
 
     void accept(StatementVisitor<void>& visitor) override
@@ -27,19 +25,19 @@ public:
         return visitor.visit_block(*this);
     }
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return braced_statement_list->get_first_token();
     }
 
-    [[nodiscard]] Token get_last_token() const override
+    [[nodiscard]] const Token& find_last_token() const override
     {
         return braced_statement_list->get_last_token();
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
-        return braced_statement_list->get_text();
+        return braced_statement_list->reconstruct_text();
     };
 
     [[nodiscard]] bool is_block() const override
@@ -7,16 +7,19 @@
 class Break final : public Statement
 {
 public:
+    static constexpr auto static_kind = NodeKind::Break;
+
     Token keyword;
 
     explicit Break(Token keyword)
-        : keyword(std::move(keyword))
+        : Statement(static_kind),
+          keyword(std::move(keyword))
     {
     }
 
     static statement_ptr_t create(Token keyword)
     {
-        return std::make_unique<Break>(std::move(keyword));
+        return create_node<Break>(std::move(keyword));
     }
 
     void accept(StatementVisitor<void>& visitor) override
@@ -24,13 +27,13 @@ public:
         return visitor.visit_break(*this);
     }
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return keyword;
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
-        return keyword.get_text();
+        return std::string(keyword.get_text());
     }
 };
\ No newline at end of file
@@ -7,15 +7,17 @@
 class Continue final : public Statement
 {
 public:
+    static constexpr auto static_kind = NodeKind::Continue;
+
     Token keyword;
 
-    explicit Continue(Token keyword) : keyword(std::move(keyword))
+    explicit Continue(Token keyword) : Statement(static_kind), keyword(std::move(keyword))
     {
     }
 
     static statement_ptr_t create(Token keyword)
     {
-        return std::make_unique<Continue>(std::move(keyword));
+        return create_node<Continue>(std::move(keyword));
     }
 
     void accept(StatementVisitor<void>& visitor) override
@@ -23,13 +25,13 @@ public:
         return visitor.visit_continue(*this);
     }
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return keyword;
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
-        return keyword.get_text();
+        return std::string(keyword.get_text());
     }
 };
\ No newline at end of file
@@ -10,13 +10,16 @@
 class Decorator final : public Statement
 {
 public:
+    static constexpr auto static_kind = NodeKind::Decorator;
+
     Token at_token, name;
     std::optional<Token> l_paren, r_paren;
     std::vector<expression_ptr_t> arguments;
 
     explicit Decorator(Token at_token, Token name, std::optional<Token> l_paren, std::optional<Token> r_paren,
                        std::vector<expression_ptr_t> arguments)
-        : at_token(std::move(at_token)),
+        : Statement(static_kind),
+          at_token(std::move(at_token)),
           name(std::move(name)),
           l_paren(std::move(l_paren)),
           r_paren(std::move(r_paren)),
@@ -27,7 +30,7 @@ public:
     static statement_ptr_t create(Token at_token, Token name, std::optional<Token> l_paren, std::optional<Token> r_paren,
                                   std::vector<expression_ptr_t> arguments)
     {
-        return std::make_unique<Decorator>(std::move(at_token), std::move(name), std::move(l_paren), std::move(r_paren),
+        return create_node<Decorator>(std::move(at_token), std::move(name), std::move(l_paren), std::move(r_paren),
                                            std::move(arguments));
     }
 
@@ -36,19 +39,19 @@ public:
         return visitor.visit_decorator(*this);
     }
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return at_token;
     }
 
-    [[nodiscard]] Token get_last_token() const override
+    [[nodiscard]] const Token& find_last_token() const override
     {
-        return r_paren.value_or(name);
+        return r_paren.has_value() ? *r_paren : name;
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
         const auto arguments_text = join_by(arguments, ", ");
-        return '@' + name.get_text() + (!arguments.empty() ? '(' + arguments_text + ')' : "");
+        return '@' + std::string(name.get_text()) + (!arguments.empty() ? '(' + arguments_text + ')' : "");
     }
 };
\ No newline at end of file
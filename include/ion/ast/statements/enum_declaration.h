@@ -7,24 +7,21 @@
 class EnumDeclaration final : public NamedDeclaration
 {
 public:
+    static constexpr auto static_kind = NodeKind::EnumDeclaration;
+
     Token enum_keyword;
     BracedStatementList* members;
 
     explicit EnumDeclaration(Token enum_keyword, Token name, BracedStatementList* members)
-        : NamedDeclaration(std::move(name)),
+        : NamedDeclaration(static_kind, std::move(name)),
           enum_keyword(std::move(enum_keyword)),
           members(members)
     {
     }
 
-    ~EnumDeclaration() override
-    {
-        delete members;
-    }
-
     static statement_ptr_t create(Token enum_keyword, Token name, BracedStatementList* members)
     {
-        return std::make_unique<EnumDeclaration>(std::move(enum_keyword), std::move(name), members);
+        return create_node<EnumDeclaration>(std::move(enum_keyword), std::move(name), members);
     }
 
     void accept(StatementVisitor<void>& visitor) override
@@ -32,18 +29,18 @@ public:
         return visitor.visit_enum_declaration(*this);
     }
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return enum_keyword;
     }
 
-    [[nodiscard]] Token get_last_token() const override
+    [[nodiscard]] const Token& find_last_token() const override
     {
         return members->get_last_token();
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
-        return "enum " + name.get_text() + ' ' + members->get_text();
+        return "enum " + std::string(name.get_text()) + ' ' + members->reconstruct_text();
     }
 };
\ No newline at end of file
@@ -0,0 +1,44 @@
+#pragma once
+#include "ion/token.h"
+#include "ion/ast/node.h"
+
+/** Stands in for the tokens the parser skipped while recovering from a syntax error, later passes ignore it */
+class ErrorStatement final : public Statement
+{
+public:
+    static constexpr auto static_kind = NodeKind::ErrorStatement;
+
+    Token first_token, last_token;
+
+    ErrorStatement(Token first_token, Token last_token)
+        : Statement(static_kind),
+          first_token(std::move(first_token)),
+          last_token(std::move(last_token))
+    {
+    }
+
+    static statement_ptr_t create(Token first_token, Token last_token)
+    {
+        return create_node<ErrorStatement>(std::move(first_token), std::move(last_token));
+    }
+
+    void accept(StatementVisitor<void>& visitor) override
+    {
+        return visitor.visit_error_statement(*this);
+    }
+
+    [[nodiscard]] const Token& find_first_token() const override
+    {
+        return first_token;
+    }
+
+    [[nodiscard]] const Token& find_last_token() const override
+    {
+        return last_token;
+    }
+
+    [[nodiscard]] std::string reconstruct_text() const override
+    {
+        return std::string(get_text());
+    }
+};
@@ -9,6 +9,8 @@
 class EventDeclaration final : public NamedDeclaration
 {
 public:
+    static constexpr auto static_kind = NodeKind::EventDeclaration;
+
     Token event_keyword;
     std::optional<Token> l_paren, r_paren;
     /** Generics */
@@ -23,7 +25,7 @@ public:
         std::optional<Token> l_paren,
         std::vector<type_ref_ptr_t> parameter_types,
         std::optional<Token> r_paren)
-        : NamedDeclaration(std::move(name)),
+        : NamedDeclaration(static_kind, std::move(name)),
           event_keyword(std::move(event_keyword)),
           l_paren(std::move(l_paren)),
           r_paren(std::move(r_paren)),
@@ -32,12 +34,6 @@ public:
     {
     }
 
-    ~EventDeclaration() override
-    {
-        if (type_parameters.has_value())
-            delete *type_parameters;
-    }
-
     static statement_ptr_t create(
         Token event_keyword,
         Token name,
@@ -46,7 +42,7 @@ public:
         std::vector<type_ref_ptr_t> parameter_types,
         std::optional<Token> r_paren)
     {
-        return std::make_unique<EventDeclaration>(std::move(event_keyword), std::move(name), type_parameters,
+        return create_node<EventDeclaration>(std::move(event_keyword), std::move(name), type_parameters,
                                                   std::move(l_paren), std::move(parameter_types), std::move(r_paren));
     }
 
@@ -55,12 +51,12 @@ public:
         return visitor.visit_event_declaration(*this);
     }
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return event_keyword;
     }
 
-    [[nodiscard]] Token get_last_token() const override
+    [[nodiscard]] const Token& find_last_token() const override
     {
         return r_paren.has_value()
                    ? *r_paren
@@ -69,14 +65,14 @@ public:
                          : name;
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
-        const auto type_parameters_text = type_parameters.has_value() ? type_parameters.value()->get_text() : "";
+        const auto type_parameters_text = type_parameters.has_value() ? type_parameters.value()->reconstruct_text() : "";
         const auto l_paren_text = l_paren.has_value() ? "(" : "";
         const auto parameter_types_text = join_by(parameter_types, ", ");
         const auto r_paren_text = r_paren.has_value() ? ")" : "";
 
-        return "event " + name.get_text() + type_parameters_text
+        return "event " + std::string(name.get_text()) + type_parameters_text
                + l_paren_text + parameter_types_text + r_paren_text;
     }
 };
\ No newline at end of file
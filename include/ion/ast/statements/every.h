@@ -7,6 +7,8 @@
 class Every final : public Statement
 {
 public:
+    static constexpr auto static_kind = NodeKind::Every;
+
     Token every_keyword;
     expression_ptr_t time_expression;
     std::optional<Token> while_keyword;
@@ -15,7 +17,8 @@ public:
 
     explicit Every(Token every_keyword, expression_ptr_t time_expression, std::optional<Token> while_keyword,
                    std::optional<expression_ptr_t> condition, statement_ptr_t statement)
-        : every_keyword(std::move(every_keyword)),
+        : Statement(static_kind),
+          every_keyword(std::move(every_keyword)),
           time_expression(std::move(time_expression)),
           while_keyword(std::move(while_keyword)),
           condition(std::move(condition)),
@@ -26,7 +29,7 @@ public:
     static statement_ptr_t create(Token every_keyword, expression_ptr_t time_expression, std::optional<Token> while_keyword,
                                   std::optional<expression_ptr_t> condition, statement_ptr_t statement)
     {
-        return std::make_unique<Every>(std::move(every_keyword), std::move(time_expression), std::move(while_keyword),
+        return create_node<Every>(std::move(every_keyword), std::move(time_expression), std::move(while_keyword),
                                        std::move(condition), std::move(statement));
     }
 
@@ -35,20 +38,20 @@ public:
         return visitor.visit_every(*this);
     }
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return every_keyword;
     }
 
-    [[nodiscard]] Token get_last_token() const override
+    [[nodiscard]] const Token& find_last_token() const override
     {
         return statement->get_last_token();
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
         const auto separator = statement->is_block() ? ' ' : '\n';
-        const auto condition_text = condition.has_value() ? " while " + condition.value()->get_text() : "";
-        return "every " + time_expression->get_text() + condition_text + separator + statement->get_text();
+        const auto condition_text = condition.has_value() ? " while " + condition.value()->reconstruct_text() : "";
+        return "every " + time_expression->reconstruct_text() + condition_text + separator + statement->reconstruct_text();
     }
 };
\ No newline at end of file
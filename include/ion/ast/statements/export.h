@@ -7,18 +7,21 @@
 class Export final : public Statement
 {
 public:
+    static constexpr auto static_kind = NodeKind::Export;
+
     Token export_keyword;
     statement_ptr_t statement;
 
     explicit Export(Token export_keyword, statement_ptr_t statement)
-        : export_keyword(std::move(export_keyword)),
+        : Statement(static_kind),
+          export_keyword(std::move(export_keyword)),
           statement(std::move(statement))
     {
     }
 
     static statement_ptr_t create(Token export_keyword, statement_ptr_t statement)
     {
-        return std::make_unique<Export>(std::move(export_keyword), std::move(statement));
+        return create_node<Export>(std::move(export_keyword), std::move(statement));
     }
 
     void accept(StatementVisitor<void>& visitor) override
@@ -26,18 +29,18 @@ public:
         return visitor.visit_export(*this);
     }
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return export_keyword;
     }
 
-    [[nodiscard]] Token get_last_token() const override
+    [[nodiscard]] const Token& find_last_token() const override
     {
         return statement->get_last_token();
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
-        return "export " + statement->get_text();
+        return "export " + statement->reconstruct_text();
     }
 };
\ No newline at end of file
@@ -8,16 +8,19 @@
 class ExpressionStatement final : public Statement
 {
 public:
+    static constexpr auto static_kind = NodeKind::ExpressionStatement;
+
     expression_ptr_t expression;
 
     explicit ExpressionStatement(expression_ptr_t expression)
-        : expression(std::move(expression))
+        : Statement(static_kind),
+          expression(std::move(expression))
     {
     }
 
     static statement_ptr_t create(expression_ptr_t expression)
     {
-        return std::make_unique<ExpressionStatement>(std::move(expression));
+        return create_node<ExpressionStatement>(std::move(expression));
     }
 
     void accept(StatementVisitor<void>& visitor) override
@@ -25,18 +28,18 @@ public:
         return visitor.visit_expression_statement(*this);
     }
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return expression->get_first_token();
     }
 
-    [[nodiscard]] Token get_last_token() const override
+    [[nodiscard]] const Token& find_last_token() const override
     {
         return expression->get_last_token();
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
-        return expression->get_text();
+        return expression->reconstruct_text();
     }
 };
\ No newline at end of file
@@ -11,13 +11,16 @@
 class For final : public Statement
 {
 public:
+    static constexpr auto static_kind = NodeKind::For;
+
     Token for_keyword, colon_token;
     std::vector<Token> names;
     expression_ptr_t iterable;
     statement_ptr_t statement;
 
     explicit For(Token for_keyword, std::vector<Token> names, Token colon_token, expression_ptr_t iterable, statement_ptr_t statement)
-        : for_keyword(std::move(for_keyword)),
+        : Statement(static_kind),
+          for_keyword(std::move(for_keyword)),
           colon_token(std::move(colon_token)),
           names(std::move(names)),
           iterable(std::move(iterable)),
@@ -28,7 +31,7 @@ public:
     static statement_ptr_t create(Token for_keyword, std::vector<Token> names, Token colon_token, expression_ptr_t iterable,
                                   statement_ptr_t statement)
     {
-        return std::make_unique<For>(std::move(for_keyword), std::move(names), std::move(colon_token), std::move(iterable),
+        return create_node<For>(std::move(for_keyword), std::move(names), std::move(colon_token), std::move(iterable),
                                      std::move(statement));
     }
 
@@ -37,19 +40,19 @@ public:
         return visitor.visit_for(*this);
     }
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return for_keyword;
     }
 
-    [[nodiscard]] Token get_last_token() const override
+    [[nodiscard]] const Token& find_last_token() const override
     {
         return statement->get_last_token();
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
         const auto separator = statement->is_block() ? ' ' : '\n';
-        return "for " + join_by(names, ", ") + " : " + iterable->get_text() + separator + statement->get_text();
+        return "for " + join_by(names, ", ") + " : " + iterable->reconstruct_text() + separator + statement->reconstruct_text();
     }
 };
\ No newline at end of file
@@ -8,6 +8,8 @@
 class If final : public Statement
 {
 public:
+    static constexpr auto static_kind = NodeKind::If;
+
     Token if_keyword;
     expression_ptr_t condition;
     statement_ptr_t then_branch;
@@ -16,7 +18,8 @@ public:
 
     explicit If(Token if_keyword, expression_ptr_t condition, statement_ptr_t then_branch,
                 std::optional<Token> else_keyword, std::optional<statement_ptr_t> else_branch)
-        : if_keyword(std::move(if_keyword)),
+        : Statement(static_kind),
+          if_keyword(std::move(if_keyword)),
           condition(std::move(condition)),
           then_branch(std::move(then_branch)),
           else_keyword(std::move(else_keyword)),
@@ -27,7 +30,7 @@ public:
     static statement_ptr_t create(Token if_keyword, expression_ptr_t condition, statement_ptr_t then_branch,
                                   std::optional<Token> else_keyword, std::optional<statement_ptr_t> else_branch)
     {
-        return std::make_unique<If>(std::move(if_keyword), std::move(condition), std::move(then_branch),
+        return create_node<If>(std::move(if_keyword), std::move(condition), std::move(then_branch),
                                     std::move(else_keyword), std::move(else_branch));
     }
 
@@ -36,23 +39,23 @@ public:
         return visitor.visit_if(*this);
     }
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return if_keyword;
     }
 
-    [[nodiscard]] Token get_last_token() const override
+    [[nodiscard]] const Token& find_last_token() const override
     {
         return else_branch.has_value() ? else_branch.value()->get_last_token() : then_branch->get_last_token();
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
         const auto separator = then_branch->is_block() ? ' ' : '\n';
         const auto else_text = else_branch.has_value()
-                                   ? std::string("else ") + separator + else_branch.value()->get_text()
+                                   ? std::string("else ") + separator + else_branch.value()->reconstruct_text()
                                    : "";
 
-        return "if " + condition->get_text() + separator + then_branch->get_text() + else_text;
+        return "if " + condition->reconstruct_text() + separator + then_branch->reconstruct_text() + else_text;
     }
 };
\ No newline at end of file
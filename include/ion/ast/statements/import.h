@@ -9,6 +9,8 @@
 class Import final : public Statement
 {
 public:
+    static constexpr auto static_kind = NodeKind::Import;
+
     Token import_keyword;
     std::vector<Token> names;
     std::optional<Token> from_keyword;
@@ -16,7 +18,8 @@ public:
 
     explicit Import(Token import_keyword, std::vector<Token> names, std::optional<Token> from_keyword,
                     Token module_name)
-        : import_keyword(std::move(import_keyword)),
+        : Statement(static_kind),
+          import_keyword(std::move(import_keyword)),
           names(std::move(names)),
           from_keyword(std::move(from_keyword)),
           module_name(std::move(module_name))
@@ -26,7 +29,7 @@ public:
     static statement_ptr_t create(Token import_keyword, std::vector<Token> names, std::optional<Token> from_keyword,
                                   Token module_name)
     {
-        return std::make_unique<Import>(std::move(import_keyword), std::move(names), std::move(from_keyword),
+        return create_node<Import>(std::move(import_keyword), std::move(names), std::move(from_keyword),
                                         std::move(module_name));
     }
 
@@ -35,18 +38,18 @@ public:
         return visitor.visit_import(*this);
     }
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return import_keyword;
     }
 
-    [[nodiscard]] Token get_last_token() const override
+    [[nodiscard]] const Token& find_last_token() const override
     {
         return module_name;
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
-        return "import " + join_by(names, ", ") + " from " + module_name.get_text();
+        return "import " + join_by(names, ", ") + " from " + std::string(module_name.get_text());
     }
 };
\ No newline at end of file
@@ -8,6 +8,8 @@
 class InstanceConstructor final : public NamedDeclaration
 {
 public:
+    static constexpr auto static_kind = NodeKind::InstanceConstructor;
+
     // TODO: allow no type when `clone` clause is used
     Token instance_keyword;
     std::optional<Token> long_arrow, clone_keyword;
@@ -24,7 +26,7 @@ public:
         std::optional<BracedStatementList*> declarators,
         std::optional<Token> long_arrow,
         std::optional<expression_ptr_t> parent)
-        : NamedDeclaration(std::move(name)),
+        : NamedDeclaration(static_kind, std::move(name)),
           instance_keyword(std::move(instance_keyword)),
           long_arrow(std::move(long_arrow)),
           clone_keyword(std::move(clone_keyword)),
@@ -45,7 +47,7 @@ public:
         std::optional<Token> long_arrow,
         std::optional<expression_ptr_t> parent)
     {
-        return std::make_unique<InstanceConstructor>(std::move(instance_keyword), std::move(name), colon_type,
+        return create_node<InstanceConstructor>(std::move(instance_keyword), std::move(name), colon_type,
                                                      std::move(clone_keyword), std::move(clone_target), declarators,
                                                      std::move(long_arrow), std::move(parent));
     }
@@ -55,12 +57,12 @@ public:
         return visitor.visit_instance_constructor(*this);
     }
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return instance_keyword;
     }
 
-    [[nodiscard]] Token get_last_token() const override
+    [[nodiscard]] const Token& find_last_token() const override
     {
         return parent.has_value()
                    ? parent.value()->get_last_token()
@@ -71,12 +73,12 @@ public:
                                : colon_type->get_last_token();
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
-        const auto clone_clause_text = clone_target.has_value() ? " clone " + clone_target.value()->get_text() : "";
-        const auto declarators_text = declarators.has_value() ? declarators.value()->get_text() + ' ' : "";
-        const auto parent_text = parent.has_value() ? "-> " + parent.value()->get_text() : "";
+        const auto clone_clause_text = clone_target.has_value() ? " clone " + clone_target.value()->reconstruct_text() : "";
+        const auto declarators_text = declarators.has_value() ? declarators.value()->reconstruct_text() + ' ' : "";
+        const auto parent_text = parent.has_value() ? "-> " + parent.value()->reconstruct_text() : "";
 
-        return "instance " + name.get_text() + colon_type->get_text() + clone_clause_text + ' ' + declarators_text + parent_text;
+        return "instance " + std::string(name.get_text()) + colon_type->reconstruct_text() + clone_clause_text + ' ' + declarators_text + parent_text;
     }
 };
\ No newline at end of file
@@ -7,8 +7,8 @@
 class InstanceDeclarator : public NamedDeclaration
 {
 protected:
-    explicit InstanceDeclarator(Token name)
-        : NamedDeclaration(std::move(name))
+    InstanceDeclarator(const NodeKind kind, Token name)
+        : NamedDeclaration(kind, std::move(name))
     {
     }
 };
\ No newline at end of file
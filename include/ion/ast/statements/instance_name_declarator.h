@@ -7,13 +7,15 @@
 class InstanceNameDeclarator final : public InstanceDeclarator
 {
 public:
-    explicit InstanceNameDeclarator(Token name_literal) : InstanceDeclarator(std::move(name_literal))
+    static constexpr auto static_kind = NodeKind::InstanceNameDeclarator;
+
+    explicit InstanceNameDeclarator(Token name_literal) : InstanceDeclarator(static_kind, std::move(name_literal))
     {
     }
 
     static statement_ptr_t create(Token name_literal)
     {
-        return std::make_unique<InstanceNameDeclarator>(std::move(name_literal));
+        return create_node<InstanceNameDeclarator>(std::move(name_literal));
     }
 
     void accept(StatementVisitor<void>& visitor) override
@@ -21,13 +23,13 @@ public:
         return visitor.visit_instance_name_declarator(*this);
     }
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return name;
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
-        return name.get_text();
+        return std::string(name.get_text());
     }
 };
\ No newline at end of file
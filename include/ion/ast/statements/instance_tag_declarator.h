@@ -8,17 +8,19 @@
 class InstanceTagDeclarator final : public InstanceDeclarator
 {
 public:
+    static constexpr auto static_kind = NodeKind::InstanceTagDeclarator;
+
     Token hashtag_token;
 
     explicit InstanceTagDeclarator(Token hashtag_token, Token name)
-        : InstanceDeclarator(std::move(name)),
+        : InstanceDeclarator(static_kind, std::move(name)),
           hashtag_token(std::move(hashtag_token))
     {
     }
 
     static statement_ptr_t create(Token hashtag_token, Token name)
     {
-        return std::make_unique<InstanceTagDeclarator>(std::move(hashtag_token), std::move(name));
+        return create_node<InstanceTagDeclarator>(std::move(hashtag_token), std::move(name));
     }
 
     void accept(StatementVisitor<void>& visitor) override
@@ -26,18 +28,18 @@ public:
         return visitor.visit_instance_tag_declarator(*this);
     }
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return hashtag_token;
     }
 
-    [[nodiscard]] Token get_last_token() const override
+    [[nodiscard]] const Token& find_last_token() const override
     {
         return name;
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
-        return '#' + name.get_text();
+        return '#' + std::string(name.get_text());
     }
 };
\ No newline at end of file
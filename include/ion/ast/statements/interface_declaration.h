@@ -8,30 +8,24 @@
 class InterfaceDeclaration final : public NamedDeclaration
 {
 public:
+    static constexpr auto static_kind = NodeKind::InterfaceDeclaration;
+
     Token interface_keyword;
     std::optional<TypeListClause*> type_parameters;
     BracedStatementList* members;
 
     explicit InterfaceDeclaration(Token interface_keyword, Token name, const std::optional<TypeListClause*> type_parameters,
                                   BracedStatementList* members)
-        : NamedDeclaration(std::move(name)),
+        : NamedDeclaration(static_kind, std::move(name)),
           interface_keyword(std::move(interface_keyword)),
           type_parameters(type_parameters),
           members(members)
     {
     }
 
-    ~InterfaceDeclaration() override
-    {
-        if (type_parameters.has_value())
-            delete *type_parameters;
-
-        delete members;
-    }
-
     static statement_ptr_t create(Token interface_keyword, Token name, const std::optional<TypeListClause*> type_parameters, BracedStatementList* members)
     {
-        return std::make_unique<InterfaceDeclaration>(std::move(interface_keyword), std::move(name), type_parameters, members);
+        return create_node<InterfaceDeclaration>(std::move(interface_keyword), std::move(name), type_parameters, members);
     }
 
     void accept(StatementVisitor<void>& visitor) override
@@ -39,18 +33,18 @@ public:
         return visitor.visit_interface_declaration(*this);
     }
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return interface_keyword;
     }
 
-    [[nodiscard]] Token get_last_token() const override
+    [[nodiscard]] const Token& find_last_token() const override
     {
         return members->get_last_token();
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
-        return "interface " + name.get_text() + ' ' + members->get_text();
+        return "interface " + std::string(name.get_text()) + ' ' + members->reconstruct_text();
     }
 };
\ No newline at end of file
@@ -7,6 +7,8 @@
 class InterfaceMethod final : public NamedDeclaration
 {
 public:
+    static constexpr auto static_kind = NodeKind::InterfaceMethod;
+
     Token fn_keyword, l_paren, r_paren, colon_token;
     /** Generics */
     std::optional<TypeListClause*> type_parameters;
@@ -16,7 +18,7 @@ public:
 
     explicit InterfaceMethod(Token fn_keyword, Token name, std::optional<TypeListClause*> type_parameters, Token l_paren,
                              std::vector<type_ref_ptr_t> parameter_types, Token r_paren, Token colon_token, type_ref_ptr_t return_type)
-        : NamedDeclaration(std::move(name)),
+        : NamedDeclaration(static_kind, std::move(name)),
           fn_keyword(std::move(fn_keyword)),
           l_paren(std::move(l_paren)),
           r_paren(std::move(r_paren)),
@@ -30,7 +32,7 @@ public:
     static statement_ptr_t create(Token fn_keyword, Token name, std::optional<TypeListClause*> type_parameters, Token l_paren,
                                   std::vector<type_ref_ptr_t> parameter_types, Token r_paren, Token colon_token, type_ref_ptr_t return_type)
     {
-        return std::make_unique<InterfaceMethod>(std::move(fn_keyword), std::move(name), type_parameters,
+        return create_node<InterfaceMethod>(std::move(fn_keyword), std::move(name), type_parameters,
                                                  std::move(l_paren), std::move(parameter_types), std::move(r_paren),
                                                  std::move(colon_token), std::move(return_type));
     }
@@ -40,22 +42,22 @@ public:
         return visitor.visit_interface_method(*this);
     }
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return fn_keyword;
     }
 
-    [[nodiscard]] Token get_last_token() const override
+    [[nodiscard]] const Token& find_last_token() const override
     {
         return return_type->get_last_token();
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
-        const auto type_parameters_text = type_parameters.has_value() ? type_parameters.value()->get_text() : "";
+        const auto type_parameters_text = type_parameters.has_value() ? type_parameters.value()->reconstruct_text() : "";
         const auto parameter_types_text = '(' + join_by(parameter_types, ", ") + ')';
-        const auto return_type_text = ": " + return_type->get_text();
+        const auto return_type_text = ": " + return_type->reconstruct_text();
 
-        return "fn " + name.get_text() + type_parameters_text + parameter_types_text + return_type_text;
+        return "fn " + std::string(name.get_text()) + type_parameters_text + parameter_types_text + return_type_text;
     }
 };
\ No newline at end of file
@@ -7,25 +7,23 @@
 class Match final : public Statement
 {
 public:
+    static constexpr auto static_kind = NodeKind::Match;
+
     Token match_keyword;
     expression_ptr_t expression;
     BracedStatementList* cases;
 
     explicit Match(Token match_keyword, expression_ptr_t expression, BracedStatementList* cases)
-        : match_keyword(std::move(match_keyword)),
+        : Statement(static_kind),
+          match_keyword(std::move(match_keyword)),
           expression(std::move(expression)),
           cases(cases)
     {
     }
 
-    ~Match() override
-    {
-        delete cases;
-    }
-
     static statement_ptr_t create(Token match_keyword, expression_ptr_t expression, BracedStatementList* members)
     {
-        return std::make_unique<Match>(std::move(match_keyword), std::move(expression), members);
+        return create_node<Match>(std::move(match_keyword), std::move(expression), members);
     }
 
     void accept(StatementVisitor<void>& visitor) override
@@ -33,18 +31,18 @@ public:
         return visitor.visit_match(*this);
     }
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return match_keyword;
     }
 
-    [[nodiscard]] Token get_last_token() const override
+    [[nodiscard]] const Token& find_last_token() const override
     {
         return cases->get_last_token();
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
-        return "match " + expression->get_text() + ' ' + cases->get_text();
+        return "match " + expression->reconstruct_text() + ' ' + cases->reconstruct_text();
     }
 };
\ No newline at end of file
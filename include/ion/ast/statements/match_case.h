@@ -7,12 +7,15 @@
 class MatchCase final : public Statement
 {
 public:
+    static constexpr auto static_kind = NodeKind::MatchCase;
+
     std::vector<expression_ptr_t> comparands;
     Token long_arrow;
     statement_ptr_t statement;
 
     explicit MatchCase(std::vector<expression_ptr_t> comparands, Token long_arrow, statement_ptr_t statement)
-        : comparands(std::move(comparands)),
+        : Statement(static_kind),
+          comparands(std::move(comparands)),
           long_arrow(std::move(long_arrow)),
           statement(std::move(statement))
     {
@@ -20,7 +23,7 @@ public:
 
     static statement_ptr_t create(std::vector<expression_ptr_t> comparands, Token long_arrow, statement_ptr_t statement)
     {
-        return std::make_unique<MatchCase>(std::move(comparands), std::move(long_arrow), std::move(statement));
+        return create_node<MatchCase>(std::move(comparands), std::move(long_arrow), std::move(statement));
     }
 
     void accept(StatementVisitor<void>& visitor) override
@@ -28,18 +31,18 @@ public:
         return visitor.visit_match_case(*this);
     }
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return comparands.front()->get_first_token();
     }
 
-    [[nodiscard]] Token get_last_token() const override
+    [[nodiscard]] const Token& find_last_token() const override
     {
         return statement->get_last_token();
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
-        return join_by(comparands, ", ") + " -> " + statement->get_text();
+        return join_by(comparands, ", ") + " -> " + statement->reconstruct_text();
     }
 };
\ No newline at end of file
@@ -9,8 +9,9 @@ class NamedDeclaration : public Statement
 public:
     Token name;
 
-    explicit NamedDeclaration(Token name)
-        : name(std::move(name))
+    NamedDeclaration(const NodeKind kind, Token name)
+        : Statement(kind),
+          name(std::move(name))
     {
     }
 };
\ No newline at end of file
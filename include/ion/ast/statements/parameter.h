@@ -8,6 +8,8 @@
 class Parameter final : public Statement
 {
 public:
+    static constexpr auto static_kind = NodeKind::Parameter;
+
     Token name;
     std::optional<ColonTypeClause*> colon_type;
     std::optional<EqualsValueClause*> equals_value;
@@ -16,26 +18,19 @@ public:
         Token name,
         const std::optional<ColonTypeClause*> colon_type,
         const std::optional<EqualsValueClause*> equals_value)
-        : name(std::move(name)),
+        : Statement(static_kind),
+          name(std::move(name)),
           colon_type(colon_type),
           equals_value(equals_value)
     {
     }
 
-    ~Parameter() override
-    {
-        if (colon_type.has_value())
-            delete *colon_type;
-        if (equals_value.has_value())
-            delete *equals_value;
-    }
-
     static statement_ptr_t create(
         Token name,
         const std::optional<ColonTypeClause*> colon_type,
         const std::optional<EqualsValueClause*> equals_value)
     {
-        return std::make_unique<Parameter>(std::move(name), colon_type, equals_value);
+        return create_node<Parameter>(std::move(name), colon_type, equals_value);
     }
 
     void accept(StatementVisitor<void>& visitor) override
@@ -43,12 +38,12 @@ public:
         return visitor.visit_parameter(*this);
     }
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return name;
     }
 
-    [[nodiscard]] Token get_last_token() const override
+    [[nodiscard]] const Token& find_last_token() const override
     {
         return equals_value.has_value()
                    ? equals_value.value()->get_last_token()
@@ -57,11 +52,11 @@ public:
                          : name;
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
-        const auto initializer_text = equals_value.has_value() ? equals_value.value()->get_text() : "";
-        const auto colon_type_text = colon_type.has_value() ? colon_type.value()->get_text() : "";
+        const auto initializer_text = equals_value.has_value() ? equals_value.value()->reconstruct_text() : "";
+        const auto colon_type_text = colon_type.has_value() ? colon_type.value()->reconstruct_text() : "";
 
-        return name.get_text() + colon_type_text + initializer_text;
+        return std::string(name.get_text()) + colon_type_text + initializer_text;
     }
 };
\ No newline at end of file
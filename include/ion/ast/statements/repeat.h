@@ -7,12 +7,15 @@
 class Repeat final : public Statement
 {
 public:
+    static constexpr auto static_kind = NodeKind::Repeat;
+
     Token repeat_keyword, while_keyword;
     expression_ptr_t condition;
     statement_ptr_t statement;
 
     explicit Repeat(Token repeat_keyword, statement_ptr_t statement, Token while_keyword, expression_ptr_t condition)
-        : repeat_keyword(std::move(repeat_keyword)),
+        : Statement(static_kind),
+          repeat_keyword(std::move(repeat_keyword)),
           while_keyword(std::move(while_keyword)),
           condition(std::move(condition)),
           statement(std::move(statement))
@@ -21,7 +24,7 @@ public:
 
     static statement_ptr_t create(Token repeat_keyword, statement_ptr_t statement, Token while_keyword, expression_ptr_t condition)
     {
-        return std::make_unique<Repeat>(std::move(repeat_keyword), std::move(statement), std::move(while_keyword), std::move(condition));
+        return create_node<Repeat>(std::move(repeat_keyword), std::move(statement), std::move(while_keyword), std::move(condition));
     }
 
     void accept(StatementVisitor<void>& visitor) override
@@ -29,19 +32,19 @@ public:
         return visitor.visit_repeat(*this);
     }
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return repeat_keyword;
     }
 
-    [[nodiscard]] Token get_last_token() const override
+    [[nodiscard]] const Token& find_last_token() const override
     {
         return condition->get_last_token();
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
         const auto separator = statement->is_block() ? ' ' : '\n';
-        return std::string("repeat") + separator + statement->get_text() + separator + "while " + condition->get_text();
+        return std::string("repeat") + separator + statement->reconstruct_text() + separator + "while " + condition->reconstruct_text();
     }
 };
\ No newline at end of file
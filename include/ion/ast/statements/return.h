@@ -7,18 +7,21 @@
 class Return final : public Statement
 {
 public:
+    static constexpr auto static_kind = NodeKind::Return;
+
     Token return_keyword;
     std::optional<expression_ptr_t> expression;
 
     explicit Return(Token return_keyword, std::optional<expression_ptr_t> expression)
-        : return_keyword(std::move(return_keyword)),
+        : Statement(static_kind),
+          return_keyword(std::move(return_keyword)),
           expression(std::move(expression))
     {
     }
 
     static statement_ptr_t create(Token return_keyword, std::optional<expression_ptr_t> expression)
     {
-        return std::make_unique<Return>(std::move(return_keyword), std::move(expression));
+        return create_node<Return>(std::move(return_keyword), std::move(expression));
     }
 
     void accept(StatementVisitor<void>& visitor) override
@@ -26,19 +29,19 @@ public:
         return visitor.visit_return(*this);
     }
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return return_keyword;
     }
 
-    [[nodiscard]] Token get_last_token() const override
+    [[nodiscard]] const Token& find_last_token() const override
     {
         return expression.has_value() ? expression.value()->get_last_token() : return_keyword;;
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
-        return return_keyword.get_text() + (expression.has_value() ? ' ' + expression.value()->get_text() : "");
+        return std::string(return_keyword.get_text()) + (expression.has_value() ? ' ' + expression.value()->reconstruct_text() : "");
     }
 
     [[nodiscard]] bool is_return() const override
@@ -10,6 +10,8 @@
 class TypeDeclaration final : public NamedDeclaration
 {
 public:
+    static constexpr auto static_kind = NodeKind::TypeDeclaration;
+
     Token type_keyword, equals_token;
     std::optional<TypeListClause*> type_parameters;
     type_ref_ptr_t type;
@@ -20,7 +22,7 @@ public:
         const std::optional<TypeListClause*> type_parameters,
         Token equals_token,
         type_ref_ptr_t type)
-        : NamedDeclaration(std::move(name)),
+        : NamedDeclaration(static_kind, std::move(name)),
           type_keyword(std::move(type_keyword)),
           equals_token(std::move(equals_token)),
           type_parameters(type_parameters),
@@ -28,12 +30,6 @@ public:
     {
     }
 
-    ~TypeDeclaration() override
-    {
-        if (type_parameters.has_value())
-            delete *type_parameters;
-    }
-
     static statement_ptr_t create(
         Token type_keyword,
         Token name,
@@ -41,7 +37,7 @@ public:
         Token equals_token,
         type_ref_ptr_t type)
     {
-        return std::make_unique<TypeDeclaration>(std::move(type_keyword), std::move(name), type_parameters,
+        return create_node<TypeDeclaration>(std::move(type_keyword), std::move(name), type_parameters,
                                                  std::move(equals_token), std::move(type));
     }
 
@@ -50,19 +46,19 @@ public:
         return visitor.visit_type_declaration(*this);
     }
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return type_keyword;
     }
 
-    [[nodiscard]] Token get_last_token() const override
+    [[nodiscard]] const Token& find_last_token() const override
     {
         return type->get_last_token();
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
-        const auto type_parameters_text = type_parameters.has_value() ? type_parameters.value()->get_text() : "";
-        return "type " + name.get_text() + type_parameters_text + " = " + type->get_text();
+        const auto type_parameters_text = type_parameters.has_value() ? type_parameters.value()->reconstruct_text() : "";
+        return "type " + std::string(name.get_text()) + type_parameters_text + " = " + type->reconstruct_text();
     }
 };
\ No newline at end of file
@@ -10,6 +10,8 @@
 class VariableDeclaration final : public NamedDeclaration
 {
 public:
+    static constexpr auto static_kind = NodeKind::VariableDeclaration;
+
     Token let_keyword;
     std::optional<Token> const_keyword;
     std::optional<ColonTypeClause*> colon_type;
@@ -21,7 +23,7 @@ public:
         Token name,
         const std::optional<ColonTypeClause*> colon_type,
         const std::optional<EqualsValueClause*> equals_value)
-        : NamedDeclaration(std::move(name)),
+        : NamedDeclaration(static_kind, std::move(name)),
           let_keyword(std::move(let_keyword)),
           const_keyword(std::move(const_keyword)),
           colon_type(colon_type),
@@ -29,14 +31,6 @@ public:
     {
     }
 
-    ~VariableDeclaration() override
-    {
-        if (colon_type.has_value())
-            delete *colon_type;
-        if (equals_value.has_value())
-            delete *equals_value;
-    }
-
     static statement_ptr_t create(
         Token let_keyword,
         std::optional<Token> const_keyword,
@@ -44,7 +38,7 @@ public:
         const std::optional<ColonTypeClause*> colon_type,
         const std::optional<EqualsValueClause*> equals_value)
     {
-        return std::make_unique<VariableDeclaration>(std::move(let_keyword), std::move(const_keyword), std::move(name),
+        return create_node<VariableDeclaration>(std::move(let_keyword), std::move(const_keyword), std::move(name),
                                                      colon_type, equals_value);
     }
 
@@ -53,12 +47,12 @@ public:
         return visitor.visit_variable_declaration(*this);
     }
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return let_keyword;
     }
 
-    [[nodiscard]] Token get_last_token() const override
+    [[nodiscard]] const Token& find_last_token() const override
     {
         return equals_value.has_value()
                    ? equals_value.value()->get_last_token()
@@ -67,11 +61,11 @@ public:
                          : name;
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
-        const auto equals_value_text = equals_value.has_value() ? equals_value.value()->get_text() : "";
-        const auto colon_type_text = colon_type.has_value() ? colon_type.value()->get_text() : "";
+        const auto equals_value_text = equals_value.has_value() ? equals_value.value()->reconstruct_text() : "";
+        const auto colon_type_text = colon_type.has_value() ? colon_type.value()->reconstruct_text() : "";
 
-        return "let " + name.get_text() + colon_type_text + equals_value_text;
+        return "let " + std::string(name.get_text()) + colon_type_text + equals_value_text;
     }
 };
\ No newline at end of file
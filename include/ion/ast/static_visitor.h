@@ -0,0 +1,582 @@
+#pragma once
+#include <optional>
+#include <vector>
+
+#include "ast.h"
+#include "ion/diagnostics.h"
+
+/**
+ * Traversal with the same defaults as `AstVisitor`, dispatched at compile time: nodes are switched on by their kind
+ * tag and handed straight to `Derived::visit_*`, so passes don't pay for two virtual calls per node and the compiler
+ * can inline the traversal into them. `Derived` hides whichever `visit_*` functions it wants to handle and can call
+ * the defaults as `StaticAstVisitor::visit_*`.
+ */
+template <typename Derived>
+struct StaticAstVisitor
+{
+    Derived& derived()
+    {
+        return static_cast<Derived&>(*this);
+    }
+
+    void visit_ast(const std::vector<statement_ptr_t>& statements)
+    {
+        derived().visit_statements(statements);
+    }
+
+    void visit_statements(const std::vector<statement_ptr_t>& statements)
+    {
+        for (const auto& statement : statements)
+            derived().visit(statement);
+    }
+
+    void visit_expressions(const std::vector<expression_ptr_t>& expressions)
+    {
+        for (const auto& expression : expressions)
+            derived().visit(expression);
+    }
+
+    void visit_type_refs(const std::vector<type_ref_ptr_t>& type_refs)
+    {
+        for (const auto& type_ref : type_refs)
+            derived().visit(type_ref);
+    }
+
+    void visit(const expression_ptr_t& node)
+    {
+        switch (node->kind)
+        {
+            case NodeKind::PrimitiveLiteral:
+                return derived().visit_primitive_literal(static_cast<PrimitiveLiteral&>(*node));
+            case NodeKind::ArrayLiteral:
+                return derived().visit_array_literal(static_cast<ArrayLiteral&>(*node));
+            case NodeKind::TupleLiteral:
+                return derived().visit_tuple_literal(static_cast<TupleLiteral&>(*node));
+            case NodeKind::RangeLiteral:
+                return derived().visit_range_literal(static_cast<RangeLiteral&>(*node));
+            case NodeKind::RgbLiteral:
+                return derived().visit_rgb_literal(static_cast<RgbLiteral&>(*node));
+            case NodeKind::HsvLiteral:
+                return derived().visit_hsv_literal(static_cast<HsvLiteral&>(*node));
+            case NodeKind::VectorLiteral:
+                return derived().visit_vector_literal(static_cast<VectorLiteral&>(*node));
+            case NodeKind::InterpolatedString:
+                return derived().visit_interpolated_string(static_cast<InterpolatedString&>(*node));
+            case NodeKind::Identifier:
+                return derived().visit_identifier(static_cast<Identifier&>(*node));
+            case NodeKind::Parenthesized:
+                return derived().visit_parenthesized(static_cast<Parenthesized&>(*node));
+            case NodeKind::BinaryOp:
+                return derived().visit_binary_op(static_cast<BinaryOp&>(*node));
+            case NodeKind::UnaryOp:
+                return derived().visit_unary_op(static_cast<UnaryOp&>(*node));
+            case NodeKind::PostfixUnaryOp:
+                return derived().visit_postfix_unary_op(static_cast<PostfixUnaryOp&>(*node));
+            case NodeKind::AssignmentOp:
+                return derived().visit_assignment_op(static_cast<AssignmentOp&>(*node));
+            case NodeKind::TernaryOp:
+                return derived().visit_ternary_op(static_cast<TernaryOp&>(*node));
+            case NodeKind::Invocation:
+                return derived().visit_invocation(static_cast<Invocation&>(*node));
+            case NodeKind::TypeOf:
+                return derived().visit_type_of(static_cast<TypeOf&>(*node));
+            case NodeKind::NameOf:
+                return derived().visit_name_of(static_cast<NameOf&>(*node));
+            case NodeKind::Await:
+                return derived().visit_await(static_cast<Await&>(*node));
+            case NodeKind::MemberAccess:
+                return derived().visit_member_access(static_cast<MemberAccess&>(*node));
+            case NodeKind::OptionalMemberAccess:
+                return derived().visit_optional_member_access(static_cast<OptionalMemberAccess&>(*node));
+            case NodeKind::ElementAccess:
+                return derived().visit_element_access(static_cast<ElementAccess&>(*node));
+            default:
+                report_compiler_error("StaticAstVisitor got a node that is not an expression: " + std::string(node->get_text()));
+        }
+    }
+
+    void visit(const statement_ptr_t& node)
+    {
+        switch (node->kind)
+        {
+            case NodeKind::ExpressionStatement:
+                return derived().visit_expression_statement(static_cast<ExpressionStatement&>(*node));
+            case NodeKind::Block:
+                return derived().visit_block(static_cast<Block&>(*node));
+            case NodeKind::VariableDeclaration:
+                return derived().visit_variable_declaration(static_cast<VariableDeclaration&>(*node));
+            case NodeKind::TypeDeclaration:
+                return derived().visit_type_declaration(static_cast<TypeDeclaration&>(*node));
+            case NodeKind::EventDeclaration:
+                return derived().visit_event_declaration(static_cast<EventDeclaration&>(*node));
+            case NodeKind::InterfaceDeclaration:
+                return derived().visit_interface_declaration(static_cast<InterfaceDeclaration&>(*node));
+            case NodeKind::InterfaceField:
+                return derived().visit_interface_field(static_cast<InterfaceField&>(*node));
+            case NodeKind::InterfaceMethod:
+                return derived().visit_interface_method(static_cast<InterfaceMethod&>(*node));
+            case NodeKind::EnumDeclaration:
+                return derived().visit_enum_declaration(static_cast<EnumDeclaration&>(*node));
+            case NodeKind::EnumMember:
+                return derived().visit_enum_member(static_cast<EnumMember&>(*node));
+            case NodeKind::FunctionDeclaration:
+                return derived().visit_function_declaration(static_cast<FunctionDeclaration&>(*node));
+            case NodeKind::Parameter:
+                return derived().visit_parameter(static_cast<Parameter&>(*node));
+            case NodeKind::InstanceConstructor:
+                return derived().visit_instance_constructor(static_cast<InstanceConstructor&>(*node));
+            case NodeKind::InstancePropertyDeclarator:
+                return derived().visit_instance_property_declarator(static_cast<InstancePropertyDeclarator&>(*node));
+            case NodeKind::InstanceNameDeclarator:
+                return derived().visit_instance_name_declarator(static_cast<InstanceNameDeclarator&>(*node));
+            case NodeKind::InstanceAttributeDeclarator:
+                return derived().visit_instance_attribute_declarator(static_cast<InstanceAttributeDeclarator&>(*node));
+            case NodeKind::InstanceTagDeclarator:
+                return derived().visit_instance_tag_declarator(static_cast<InstanceTagDeclarator&>(*node));
+            case NodeKind::Break:
+                return derived().visit_break(static_cast<Break&>(*node));
+            case NodeKind::Continue:
+                return derived().visit_continue(static_cast<Continue&>(*node));
+            case NodeKind::Return:
+                return derived().visit_return(static_cast<Return&>(*node));
+            case NodeKind::If:
+                return derived().visit_if(static_cast<If&>(*node));
+            case NodeKind::While:
+                return derived().visit_while(static_cast<While&>(*node));
+            case NodeKind::Repeat:
+                return derived().visit_repeat(static_cast<Repeat&>(*node));
+            case NodeKind::For:
+                return derived().visit_for(static_cast<For&>(*node));
+            case NodeKind::After:
+                return derived().visit_after(static_cast<After&>(*node));
+            case NodeKind::Every:
+                return derived().visit_every(static_cast<Every&>(*node));
+            case NodeKind::Match:
+                return derived().visit_match(static_cast<Match&>(*node));
+            case NodeKind::MatchCase:
+                return derived().visit_match_case(static_cast<MatchCase&>(*node));
+            case NodeKind::MatchElseCase:
+                return derived().visit_match_else_case(static_cast<MatchElseCase&>(*node));
+            case NodeKind::Import:
+                return derived().visit_import(static_cast<Import&>(*node));
+            case NodeKind::Export:
+                return derived().visit_export(static_cast<Export&>(*node));
+            case NodeKind::Decorator:
+                return derived().visit_decorator(static_cast<Decorator&>(*node));
+            case NodeKind::ErrorStatement:
+                return derived().visit_error_statement(static_cast<ErrorStatement&>(*node));
+            default:
+                report_compiler_error("StaticAstVisitor got a node that is not a statement: " + std::string(node->get_text()));
+        }
+    }
+
+    void visit(const type_ref_ptr_t& node)
+    {
+        switch (node->kind)
+        {
+            case NodeKind::PrimitiveTypeRef:
+                return derived().visit_primitive_type(static_cast<PrimitiveTypeRef&>(*node));
+            case NodeKind::LiteralTypeRef:
+                return derived().visit_literal_type(static_cast<LiteralTypeRef&>(*node));
+            case NodeKind::TypeNameRef:
+                return derived().visit_type_name(static_cast<TypeNameRef&>(*node));
+            case NodeKind::NullableTypeRef:
+                return derived().visit_nullable_type(static_cast<NullableTypeRef&>(*node));
+            case NodeKind::ArrayTypeRef:
+                return derived().visit_array_type(static_cast<ArrayTypeRef&>(*node));
+            case NodeKind::TupleTypeRef:
+                return derived().visit_tuple_type(static_cast<TupleTypeRef&>(*node));
+            case NodeKind::FunctionTypeRef:
+                return derived().visit_function_type(static_cast<FunctionTypeRef&>(*node));
+            case NodeKind::TypeParameterRef:
+                return derived().visit_type_parameter(static_cast<TypeParameterRef&>(*node));
+            case NodeKind::UnionTypeRef:
+                return derived().visit_union_type(static_cast<UnionTypeRef&>(*node));
+            case NodeKind::IntersectionTypeRef:
+                return derived().visit_intersection_type(static_cast<IntersectionTypeRef&>(*node));
+            default:
+                report_compiler_error("StaticAstVisitor got a node that is not a type reference: " + std::string(node->get_text()));
+        }
+    }
+
+    void visit_type_list_clause(const std::optional<TypeListClause*> type_list)
+    {
+        if (type_list.has_value())
+            derived().visit_type_refs(type_list.value()->list);
+    }
+
+    void visit_colon_type_clause(const std::optional<ColonTypeClause*> colon_type)
+    {
+        if (colon_type.has_value())
+            derived().visit(colon_type.value()->type);
+    }
+
+    void visit_equals_value_clause(const std::optional<EqualsValueClause*> equals_value)
+    {
+        if (equals_value.has_value())
+            derived().visit(equals_value.value()->value);
+    }
+
+    void visit_function_body(const FunctionBody* function_body)
+    {
+        if (function_body->block.has_value())
+            derived().visit(*function_body->block);
+        else
+            derived().visit(function_body->expression_body.value()->expression);
+    }
+
+    void visit_primitive_literal(PrimitiveLiteral&)
+    {
+    }
+
+    void visit_array_literal(ArrayLiteral& array_literal)
+    {
+        derived().visit_expressions(array_literal.elements);
+    }
+
+    void visit_tuple_literal(TupleLiteral& tuple_literal)
+    {
+        derived().visit_expressions(tuple_literal.elements);
+    }
+
+    void visit_range_literal(RangeLiteral& range_literal)
+    {
+        derived().visit(range_literal.minimum);
+        derived().visit(range_literal.maximum);
+    }
+
+    void visit_rgb_literal(RgbLiteral& rgb_literal)
+    {
+        derived().visit(rgb_literal.r);
+        derived().visit(rgb_literal.g);
+        derived().visit(rgb_literal.b);
+    }
+
+    void visit_hsv_literal(HsvLiteral& hsv_literal)
+    {
+        derived().visit(hsv_literal.h);
+        derived().visit(hsv_literal.s);
+        derived().visit(hsv_literal.v);
+    }
+
+    void visit_vector_literal(VectorLiteral& vector_literal)
+    {
+        derived().visit(vector_literal.x);
+        derived().visit(vector_literal.y);
+        derived().visit(vector_literal.z);
+    }
+
+    void visit_interpolated_string(InterpolatedString& interpolated_string)
+    {
+        derived().visit_expressions(interpolated_string.interpolations);
+    }
+
+    void visit_identifier(Identifier&)
+    {
+    }
+
+    void visit_parenthesized(Parenthesized& parenthesized)
+    {
+        derived().visit(parenthesized.expression);
+    }
+
+    void visit_binary_op(BinaryOp& binary_op)
+    {
+        derived().visit(binary_op.left);
+        derived().visit(binary_op.right);
+    }
+
+    void visit_unary_op(UnaryOp& unary_op)
+    {
+        derived().visit(unary_op.operand);
+    }
+
+    void visit_postfix_unary_op(PostfixUnaryOp& postfix_unary_op)
+    {
+        derived().visit(postfix_unary_op.operand);
+    }
+
+    void visit_assignment_op(AssignmentOp& assignment_op)
+    {
+        derived().visit_binary_op(assignment_op);
+    }
+
+    void visit_ternary_op(TernaryOp& ternary_op)
+    {
+        derived().visit(ternary_op.condition);
+        derived().visit(ternary_op.when_true);
+        derived().visit(ternary_op.when_false);
+    }
+
+    void visit_invocation(Invocation& invocation)
+    {
+        derived().visit(invocation.callee);
+        derived().visit_type_list_clause(invocation.type_arguments);
+        derived().visit_expressions(invocation.arguments);
+    }
+
+    void visit_type_of(TypeOf& type_of)
+    {
+        derived().visit(type_of.expression);
+    }
+
+    void visit_name_of(NameOf&)
+    {
+    }
+
+    void visit_await(Await& await)
+    {
+        derived().visit(await.expression);
+    }
+
+    void visit_member_access(MemberAccess& member_access)
+    {
+        derived().visit(member_access.expression);
+    }
+
+    void visit_optional_member_access(OptionalMemberAccess& optional_member_access)
+    {
+        derived().visit(optional_member_access.expression);
+    }
+
+    void visit_element_access(ElementAccess& element_access)
+    {
+        derived().visit(element_access.expression);
+        derived().visit(element_access.index_expression);
+    }
+
+    void visit_expression_statement(ExpressionStatement& expression_statement)
+    {
+        derived().visit(expression_statement.expression);
+    }
+
+    void visit_block(Block& block)
+    {
+        derived().visit_statements(block.braced_statement_list->statements);
+    }
+
+    void visit_type_declaration(TypeDeclaration& type_declaration)
+    {
+        derived().visit_type_list_clause(type_declaration.type_parameters);
+        derived().visit(type_declaration.type);
+    }
+
+    void visit_variable_declaration(VariableDeclaration& variable_declaration)
+    {
+        derived().visit_colon_type_clause(variable_declaration.colon_type);
+        derived().visit_equals_value_clause(variable_declaration.equals_value);
+    }
+
+    void visit_event_declaration(EventDeclaration& event_declaration)
+    {
+        derived().visit_type_list_clause(event_declaration.type_parameters);
+        derived().visit_type_refs(event_declaration.parameter_types);
+    }
+
+    void visit_interface_declaration(InterfaceDeclaration& interface_declaration)
+    {
+        derived().visit_statements(interface_declaration.members->statements);
+    }
+
+    void visit_interface_field(InterfaceField&)
+    {
+    }
+
+    void visit_interface_method(InterfaceMethod&)
+    {
+    }
+
+    void visit_enum_declaration(EnumDeclaration& enum_declaration)
+    {
+        derived().visit_statements(enum_declaration.members->statements);
+    }
+
+    void visit_enum_member(EnumMember&)
+    {
+    }
+
+    void visit_function_declaration(FunctionDeclaration& function_declaration)
+    {
+        derived().visit_type_list_clause(function_declaration.type_parameters);
+        if (function_declaration.parameters.has_value())
+            derived().visit_statements(function_declaration.parameters.value()->list);
+
+        derived().visit_colon_type_clause(function_declaration.return_type);
+        derived().visit_function_body(function_declaration.body);
+    }
+
+    void visit_parameter(Parameter& parameter)
+    {
+        derived().visit_colon_type_clause(parameter.colon_type);
+        derived().visit_equals_value_clause(parameter.equals_value);
+    }
+
+    void visit_instance_constructor(InstanceConstructor& instance_constructor)
+    {
+        derived().visit_colon_type_clause(instance_constructor.colon_type);
+        if (instance_constructor.declarators.has_value())
+            derived().visit_statements(instance_constructor.declarators.value()->statements);
+        if (instance_constructor.parent.has_value())
+            derived().visit(*instance_constructor.parent);
+    }
+
+    void visit_instance_property_declarator(InstancePropertyDeclarator& instance_property_declarator)
+    {
+        derived().visit(instance_property_declarator.value);
+    }
+
+    void visit_instance_name_declarator(InstanceNameDeclarator&)
+    {
+    }
+
+    void visit_instance_attribute_declarator(InstanceAttributeDeclarator& instance_attribute_declarator)
+    {
+        derived().visit(instance_attribute_declarator.value);
+    }
+
+    void visit_instance_tag_declarator(InstanceTagDeclarator&)
+    {
+    }
+
+    void visit_break(Break&)
+    {
+    }
+
+    void visit_continue(Continue&)
+    {
+    }
+
+    void visit_return(Return& return_statement)
+    {
+        if (return_statement.expression.has_value())
+            derived().visit(*return_statement.expression);
+    }
+
+    void visit_if(If& if_statement)
+    {
+        derived().visit(if_statement.condition);
+        derived().visit(if_statement.then_branch);
+        if (if_statement.else_branch.has_value())
+            derived().visit(*if_statement.else_branch);
+    }
+
+    void visit_while(While& while_statement)
+    {
+        derived().visit(while_statement.condition);
+        derived().visit(while_statement.statement);
+    }
+
+    void visit_repeat(Repeat& repeat_statement)
+    {
+        derived().visit(repeat_statement.statement);
+        derived().visit(repeat_statement.condition);
+    }
+
+    void visit_for(For& for_statement)
+    {
+        derived().visit(for_statement.iterable);
+        derived().visit(for_statement.statement);
+    }
+
+    void visit_after(After& after_statement)
+    {
+        derived().visit(after_statement.time_expression);
+        derived().visit(after_statement.statement);
+    }
+
+    void visit_every(Every& every_statement)
+    {
+        derived().visit(every_statement.time_expression);
+        if (every_statement.condition.has_value())
+            derived().visit(*every_statement.condition);
+
+        derived().visit(every_statement.statement);
+    }
+
+    void visit_match(Match& match_statement)
+    {
+        derived().visit(match_statement.expression);
+        derived().visit_statements(match_statement.cases->statements);
+    }
+
+    void visit_match_case(MatchCase& match_case)
+    {
+        derived().visit_expressions(match_case.comparands);
+        derived().visit(match_case.statement);
+    }
+
+    void visit_match_else_case(MatchElseCase& match_else_case)
+    {
+        derived().visit(match_else_case.statement);
+    }
+
+    void visit_import(Import& import_statement)
+    {
+    }
+
+    void visit_export(Export& export_statement)
+    {
+        derived().visit(export_statement.statement);
+    }
+
+    void visit_decorator(Decorator& decorator)
+    {
+        derived().visit_expressions(decorator.arguments);
+    }
+
+    void visit_error_statement(ErrorStatement&)
+    {
+    }
+
+    void visit_primitive_type(PrimitiveTypeRef&)
+    {
+    }
+
+    void visit_literal_type(LiteralTypeRef&)
+    {
+    }
+
+    void visit_type_name(TypeNameRef&)
+    {
+    }
+
+    void visit_nullable_type(NullableTypeRef& nullable_type)
+    {
+        derived().visit(nullable_type.non_nullable_type);
+    }
+
+    void visit_array_type(ArrayTypeRef& array_type)
+    {
+        derived().visit(array_type.element_type);
+    }
+
+    void visit_tuple_type(TupleTypeRef& tuple_type)
+    {
+        derived().visit_type_refs(tuple_type.element_types);
+    }
+
+    void visit_function_type(FunctionTypeRef& function_type)
+    {
+        derived().visit_type_list_clause(function_type.type_parameters);
+        derived().visit_type_refs(function_type.parameter_types);
+        derived().visit(function_type.return_type);
+    }
+
+    void visit_union_type(UnionTypeRef& union_type)
+    {
+        derived().visit_type_refs(union_type.types);
+    }
+
+    void visit_intersection_type(IntersectionTypeRef& intersection_type)
+    {
+        derived().visit_type_refs(intersection_type.types);
+    }
+
+    void visit_type_parameter(TypeParameterRef& type_parameter)
+    {
+        if (type_parameter.base_type.has_value())
+            derived().visit(*type_parameter.base_type);
+        if (type_parameter.default_type.has_value())
+            derived().visit(*type_parameter.default_type);
+    }
+};
@@ -5,11 +5,14 @@
 class ArrayTypeRef final : public TypeRef
 {
 public:
+    static constexpr auto static_kind = NodeKind::ArrayTypeRef;
+
     type_ref_ptr_t element_type;
     Token l_bracket, r_bracket;
 
     explicit ArrayTypeRef(type_ref_ptr_t element_type, Token l_bracket, Token r_bracket)
-        : element_type(std::move(element_type)),
+        : TypeRef(static_kind),
+          element_type(std::move(element_type)),
           l_bracket(std::move(l_bracket)),
           r_bracket(std::move(r_bracket))
     {
@@ -17,7 +20,7 @@ public:
 
     static type_ref_ptr_t create(type_ref_ptr_t element_type, Token l_bracket, Token r_bracket)
     {
-        return std::make_unique<ArrayTypeRef>(std::move(element_type), std::move(l_bracket), std::move(r_bracket));
+        return create_node<ArrayTypeRef>(std::move(element_type), std::move(l_bracket), std::move(r_bracket));
     }
 
     void accept(TypeRefVisitor<void>& visitor) override
@@ -25,18 +28,18 @@ public:
         return visitor.visit_array_type(*this);
     }
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return element_type->get_first_token();
     }
 
-    [[nodiscard]] Token get_last_token() const override
+    [[nodiscard]] const Token& find_last_token() const override
     {
         return r_bracket;
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
-        return element_type->get_text() + "[]";
+        return element_type->reconstruct_text() + "[]";
     }
 };
\ No newline at end of file
@@ -8,6 +8,8 @@
 class FunctionTypeRef final : public TypeRef
 {
 public:
+    static constexpr auto static_kind = NodeKind::FunctionTypeRef;
+
     /** Generics */
     std::optional<TypeListClause*> type_parameters;
     Token l_paren, r_paren, long_arrow;
@@ -18,7 +20,8 @@ public:
     explicit FunctionTypeRef(const std::optional<TypeListClause*> type_parameters,
                              Token l_paren, std::vector<type_ref_ptr_t> parameter_types, Token r_paren,
                              Token long_arrow, type_ref_ptr_t return_type)
-        : type_parameters(type_parameters),
+        : TypeRef(static_kind),
+          type_parameters(type_parameters),
           l_paren(std::move(l_paren)),
           r_paren(std::move(r_paren)),
           long_arrow(std::move(long_arrow)),
@@ -27,17 +30,11 @@ public:
     {
     }
 
-    ~FunctionTypeRef() override
-    {
-        if (type_parameters.has_value())
-            delete *type_parameters;
-    }
-
     static type_ref_ptr_t create(const std::optional<TypeListClause*> type_parameters,
                                  Token l_paren, std::vector<type_ref_ptr_t> parameter_types, Token r_paren,
                                  Token long_arrow, type_ref_ptr_t return_type)
     {
-        return std::make_unique<FunctionTypeRef>(type_parameters, std::move(l_paren), std::move(parameter_types), std::move(r_paren),
+        return create_node<FunctionTypeRef>(type_parameters, std::move(l_paren), std::move(parameter_types), std::move(r_paren),
                                                  std::move(long_arrow), std::move(return_type));
     }
 
@@ -46,19 +43,19 @@ public:
         return visitor.visit_function_type(*this);
     }
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return type_parameters.has_value() ? type_parameters.value()->get_first_token() : l_paren;
     }
 
-    [[nodiscard]] Token get_last_token() const override
+    [[nodiscard]] const Token& find_last_token() const override
     {
         return return_type->get_last_token();
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
-        const auto type_parameters_text = type_parameters.has_value() ? type_parameters.value()->get_text() : "";
-        return type_parameters_text + '(' + join_by(parameter_types, ", ") + ") -> " + return_type->get_text();
+        const auto type_parameters_text = type_parameters.has_value() ? type_parameters.value()->reconstruct_text() : "";
+        return type_parameters_text + '(' + join_by(parameter_types, ", ") + ") -> " + return_type->reconstruct_text();
     }
 };
\ No newline at end of file
@@ -8,18 +8,21 @@
 class IntersectionTypeRef final : public TypeRef
 {
 public:
+    static constexpr auto static_kind = NodeKind::IntersectionTypeRef;
+
     std::vector<Token> ampersand_tokens;
     std::vector<type_ref_ptr_t> types;
 
     explicit IntersectionTypeRef(std::vector<Token> ampersand_tokens, std::vector<type_ref_ptr_t> types)
-        : ampersand_tokens(std::move(ampersand_tokens)),
+        : TypeRef(static_kind),
+          ampersand_tokens(std::move(ampersand_tokens)),
           types(std::move(types))
     {
     }
 
     static type_ref_ptr_t create(std::vector<Token> ampersand_tokens, std::vector<type_ref_ptr_t> types)
     {
-        return std::make_unique<IntersectionTypeRef>(std::move(ampersand_tokens), std::move(types));
+        return create_node<IntersectionTypeRef>(std::move(ampersand_tokens), std::move(types));
     }
 
     void accept(TypeRefVisitor<void>& visitor) override
@@ -27,19 +30,19 @@ public:
         return visitor.visit_intersection_type(*this);
     }
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return ampersand_tokens.front().span.start < types.front()->get_span().start
                    ? ampersand_tokens.front()
                    : types.front()->get_first_token();
     }
 
-    [[nodiscard]] Token get_last_token() const override
+    [[nodiscard]] const Token& find_last_token() const override
     {
         return types.back()->get_last_token();
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
         return join_by(types, " & ");
     }
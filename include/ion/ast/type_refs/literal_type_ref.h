@@ -5,18 +5,21 @@
 class LiteralTypeRef final : public TypeRef
 {
 public:
+    static constexpr auto static_kind = NodeKind::LiteralTypeRef;
+
     Token token;
     primitive_value_t value;
 
     explicit LiteralTypeRef(Token token, primitive_value_t value)
-        : token(std::move(token)),
+        : TypeRef(static_kind),
+          token(std::move(token)),
           value(std::move(value))
     {
     }
 
     static type_ref_ptr_t create(Token token, primitive_value_t value)
     {
-        return std::make_unique<LiteralTypeRef>(std::move(token), std::move(value));
+        return create_node<LiteralTypeRef>(std::move(token), std::move(value));
     }
 
     void accept(TypeRefVisitor<void>& visitor) override
@@ -24,12 +27,12 @@ public:
         return visitor.visit_literal_type(*this);
     }
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return token;
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
         return primitive_to_string(value);
     }
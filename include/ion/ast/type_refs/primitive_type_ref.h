@@ -5,16 +5,19 @@
 class PrimitiveTypeRef final : public TypeRef
 {
 public:
+    static constexpr auto static_kind = NodeKind::PrimitiveTypeRef;
+
     Token keyword;
 
     explicit PrimitiveTypeRef(Token keyword)
-        : keyword(std::move(keyword))
+        : TypeRef(static_kind),
+          keyword(std::move(keyword))
     {
     }
 
     static type_ref_ptr_t create(Token keyword)
     {
-        return std::make_unique<PrimitiveTypeRef>(std::move(keyword));
+        return create_node<PrimitiveTypeRef>(std::move(keyword));
     }
 
     void accept(TypeRefVisitor<void>& visitor) override
@@ -22,13 +25,13 @@ public:
         return visitor.visit_primitive_type(*this);
     }
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return keyword;
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
-        return keyword.get_text();
+        return std::string(keyword.get_text());
     }
 };
\ No newline at end of file
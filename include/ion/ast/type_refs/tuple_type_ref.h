@@ -7,11 +7,14 @@
 class TupleTypeRef final : public TypeRef
 {
 public:
+    static constexpr auto static_kind = NodeKind::TupleTypeRef;
+
     Token l_paren, r_paren;
     std::vector<type_ref_ptr_t> element_types;
 
     explicit TupleTypeRef(Token l_paren, std::vector<type_ref_ptr_t> element_types, Token r_paren)
-        : l_paren(std::move(l_paren)),
+        : TypeRef(static_kind),
+          l_paren(std::move(l_paren)),
           r_paren(std::move(r_paren)),
           element_types(std::move(element_types))
     {
@@ -19,7 +22,7 @@ public:
 
     static type_ref_ptr_t create(Token l_paren, std::vector<type_ref_ptr_t> elements, Token r_paren)
     {
-        return std::make_unique<TupleTypeRef>(std::move(l_paren), std::move(elements), std::move(r_paren));
+        return create_node<TupleTypeRef>(std::move(l_paren), std::move(elements), std::move(r_paren));
     }
 
     void accept(TypeRefVisitor<void>& visitor) override
@@ -27,17 +30,17 @@ public:
         return visitor.visit_tuple_type(*this);
     }
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return l_paren;
     }
 
-    [[nodiscard]] Token get_last_token() const override
+    [[nodiscard]] const Token& find_last_token() const override
     {
         return r_paren;
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
         return '(' + join_by(element_types, ", ") + ')';
     }
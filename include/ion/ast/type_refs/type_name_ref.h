@@ -5,24 +5,21 @@
 class TypeNameRef final : public TypeRef
 {
 public:
+    static constexpr auto static_kind = NodeKind::TypeNameRef;
+
     Token name;
     std::optional<TypeListClause*> type_arguments;
 
     explicit TypeNameRef(Token name, const std::optional<TypeListClause*> type_arguments)
-        : name(std::move(name)),
+        : TypeRef(static_kind),
+          name(std::move(name)),
           type_arguments(type_arguments)
     {
     }
 
-    ~TypeNameRef() override
-    {
-        if (type_arguments.has_value())
-            delete *type_arguments;
-    }
-
     static type_ref_ptr_t create(Token name, const std::optional<TypeListClause*> type_arguments)
     {
-        return std::make_unique<TypeNameRef>(std::move(name), type_arguments);
+        return create_node<TypeNameRef>(std::move(name), type_arguments);
     }
 
     void accept(TypeRefVisitor<void>& visitor) override
@@ -30,19 +27,19 @@ public:
         return visitor.visit_type_name(*this);
     }
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return name;
     }
 
-    [[nodiscard]] Token get_last_token() const override
+    [[nodiscard]] const Token& find_last_token() const override
     {
         return type_arguments.has_value() ? type_arguments.value()->get_last_token() : name;
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
-        const auto type_arguments_text = type_arguments.has_value() ? type_arguments.value()->get_text() : "";
-        return name.get_text() + type_arguments_text;
+        const auto type_arguments_text = type_arguments.has_value() ? type_arguments.value()->reconstruct_text() : "";
+        return std::string(name.get_text()) + type_arguments_text;
     }
 };
\ No newline at end of file
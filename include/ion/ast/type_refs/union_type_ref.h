@@ -8,18 +8,21 @@
 class UnionTypeRef final : public TypeRef
 {
 public:
+    static constexpr auto static_kind = NodeKind::UnionTypeRef;
+
     std::vector<Token> pipe_tokens;
     std::vector<type_ref_ptr_t> types;
 
     explicit UnionTypeRef(std::vector<Token> pipe_tokens, std::vector<type_ref_ptr_t> types)
-        : pipe_tokens(std::move(pipe_tokens)),
+        : TypeRef(static_kind),
+          pipe_tokens(std::move(pipe_tokens)),
           types(std::move(types))
     {
     }
 
     static type_ref_ptr_t create(std::vector<Token> pipe_tokens, std::vector<type_ref_ptr_t> types)
     {
-        return std::make_unique<UnionTypeRef>(std::move(pipe_tokens), std::move(types));
+        return create_node<UnionTypeRef>(std::move(pipe_tokens), std::move(types));
     }
 
     void accept(TypeRefVisitor<void>& visitor) override
@@ -27,19 +30,19 @@ public:
         return visitor.visit_union_type(*this);
     }
 
-    [[nodiscard]] Token get_first_token() const override
+    [[nodiscard]] const Token& find_first_token() const override
     {
         return pipe_tokens.front().span.start < types.front()->get_span().start
                    ? pipe_tokens.front()
                    : types.front()->get_first_token();
     }
 
-    [[nodiscard]] Token get_last_token() const override
+    [[nodiscard]] const Token& find_last_token() const override
     {
         return types.back()->get_last_token();
     }
 
-    [[nodiscard]] std::string get_text() const override
+    [[nodiscard]] std::string reconstruct_text() const override
     {
         return join_by(types, " | ");
     }
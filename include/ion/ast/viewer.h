@@ -4,11 +4,18 @@
 #include "visitor.h"
 #include "ion/logger.h"
 
+/**
+ * How deeply indented a node can be and still be written out, deeper ones are written as `...`. Every node the viewer
+ * recurses into is indented further than its parent, so this bounds its stack use, and long chains like `a + a + ...`
+ * don't make the dump grow with the square of their length.
+ */
+constexpr unsigned int max_view_indent = 256;
+
 class AstViewer final : public AstVisitor<void>
 {
     unsigned int indent_ = 0;
 
-    static void write(const std::string&);
+    static void write(std::string_view);
     static void write(const char*);
     void write_indent() const;
     void write_line() const;
@@ -32,6 +39,10 @@ public:
         }
     }
 
+    void visit(const expression_ptr_t&) override;
+    void visit(const statement_ptr_t&) override;
+    void visit(const type_ref_ptr_t&) override;
+
     void write_binary_op_contents(const BinaryOp&);
     void write_closing_paren();
     template <typename T>
@@ -93,6 +104,7 @@ public:
     void visit_import(Import&) override;
     void visit_export(Export&) override;
     void visit_decorator(Decorator&) override;
+    void visit_error_statement(ErrorStatement&) override;
 
     void visit_primitive_type(PrimitiveTypeRef&) override;
     void visit_literal_type(LiteralTypeRef&) override;
@@ -371,6 +371,10 @@ struct AstVisitor : ExpressionVisitor<R>, StatementVisitor<R>, TypeRefVisitor<R>
         visit_expressions(decorator.arguments);
     }
 
+    void visit_error_statement(ErrorStatement&) override
+    {
+    }
+
     void visit_primitive_type(PrimitiveTypeRef&) override
     {
     }
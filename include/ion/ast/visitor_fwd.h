@@ -54,6 +54,7 @@ class MatchElseCase;
 class Import;
 class Export;
 class Decorator;
+class ErrorStatement;
 
 class PrimitiveTypeRef;
 class LiteralTypeRef;
@@ -130,6 +131,7 @@ struct StatementVisitor
     virtual R visit_import(Import&) = 0;
     virtual R visit_export(Export&) = 0;
     virtual R visit_decorator(Decorator&) = 0;
+    virtual R visit_error_statement(ErrorStatement&) = 0;
 
     virtual ~StatementVisitor() = default;
 };
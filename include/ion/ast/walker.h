@@ -0,0 +1,523 @@
+#pragma once
+#include <optional>
+#include <vector>
+
+#include "ast.h"
+#include "ion/diagnostics.h"
+
+/** Every node class an `AstWalker` can be handed, paired with the name its hooks are suffixed with */
+#define FOR_EACH_WALKED_NODE(X) \
+    X(PrimitiveLiteral, primitive_literal) \
+    X(ArrayLiteral, array_literal) \
+    X(TupleLiteral, tuple_literal) \
+    X(RangeLiteral, range_literal) \
+    X(RgbLiteral, rgb_literal) \
+    X(HsvLiteral, hsv_literal) \
+    X(VectorLiteral, vector_literal) \
+    X(InterpolatedString, interpolated_string) \
+    X(Identifier, identifier) \
+    X(Parenthesized, parenthesized) \
+    X(BinaryOp, binary_op) \
+    X(UnaryOp, unary_op) \
+    X(PostfixUnaryOp, postfix_unary_op) \
+    X(AssignmentOp, assignment_op) \
+    X(TernaryOp, ternary_op) \
+    X(Invocation, invocation) \
+    X(TypeOf, type_of) \
+    X(NameOf, name_of) \
+    X(Await, await) \
+    X(MemberAccess, member_access) \
+    X(OptionalMemberAccess, optional_member_access) \
+    X(ElementAccess, element_access) \
+    X(ExpressionStatement, expression_statement) \
+    X(Block, block) \
+    X(VariableDeclaration, variable_declaration) \
+    X(TypeDeclaration, type_declaration) \
+    X(EventDeclaration, event_declaration) \
+    X(InterfaceDeclaration, interface_declaration) \
+    X(InterfaceField, interface_field) \
+    X(InterfaceMethod, interface_method) \
+    X(EnumDeclaration, enum_declaration) \
+    X(EnumMember, enum_member) \
+    X(FunctionDeclaration, function_declaration) \
+    X(Parameter, parameter) \
+    X(InstanceConstructor, instance_constructor) \
+    X(InstancePropertyDeclarator, instance_property_declarator) \
+    X(InstanceNameDeclarator, instance_name_declarator) \
+    X(InstanceAttributeDeclarator, instance_attribute_declarator) \
+    X(InstanceTagDeclarator, instance_tag_declarator) \
+    X(Break, break) \
+    X(Continue, continue) \
+    X(Return, return) \
+    X(If, if) \
+    X(While, while) \
+    X(Repeat, repeat) \
+    X(For, for) \
+    X(After, after) \
+    X(Every, every) \
+    X(Match, match) \
+    X(MatchCase, match_case) \
+    X(MatchElseCase, match_else_case) \
+    X(Import, import) \
+    X(Export, export) \
+    X(Decorator, decorator) \
+    X(ErrorStatement, error_statement) \
+    X(PrimitiveTypeRef, primitive_type) \
+    X(LiteralTypeRef, literal_type) \
+    X(TypeNameRef, type_name) \
+    X(NullableTypeRef, nullable_type) \
+    X(ArrayTypeRef, array_type) \
+    X(TupleTypeRef, tuple_type) \
+    X(FunctionTypeRef, function_type) \
+    X(TypeParameterRef, type_parameter) \
+    X(UnionTypeRef, union_type) \
+    X(IntersectionTypeRef, intersection_type)
+
+#define DEFINE_DEFAULT_WALKER_HOOKS(node_class, name) \
+    void enter_##name(node_class&) \
+    { \
+    } \
+    void leave_##name(node_class&) \
+    { \
+    }
+
+#define DISPATCH_WALKER_HOOK(node_class, name) \
+    case NodeKind::node_class: \
+        if constexpr (Leaving) \
+            derived().leave_##name(static_cast<node_class&>(node)); \
+        else \
+        { \
+            derived().enter_##name(static_cast<node_class&>(node)); \
+            push_children(static_cast<node_class&>(node)); \
+        } \
+        return;
+
+/**
+ * Depth-first traversal over the same children as `StaticAstVisitor`, driven by an explicit work stack instead of
+ * recursion, so how deeply a tree nests is bounded by the heap rather than the call stack. `Derived` hides whichever
+ * hooks it needs: `enter_*` runs before the node's children are walked and `leave_*` after all of them have been.
+ * Every node is walked, hooks can't skip a subtree, and unlike the visitors `enter_assignment_op` doesn't fall
+ * through to `enter_binary_op`.
+ */
+template <typename Derived>
+struct AstWalker
+{
+    Derived& derived()
+    {
+        return static_cast<Derived&>(*this);
+    }
+
+    void walk_ast(const std::vector<statement_ptr_t>& statements)
+    {
+        const auto bottom = stack_.size();
+        push_all(statements);
+        run(bottom);
+    }
+
+    /** Runs on every node before its kind's `enter_*` hook */
+    void enter_node(SyntaxNode&)
+    {
+    }
+
+    /** Runs on every node after its kind's `leave_*` hook */
+    void leave_node(SyntaxNode&)
+    {
+    }
+
+    FOR_EACH_WALKED_NODE(DEFINE_DEFAULT_WALKER_HOOKS)
+
+private:
+    struct Frame
+    {
+        SyntaxNode* node;
+        /** Set once the node has been entered and its children pushed, the next time it's on top it's left */
+        bool entered;
+    };
+
+    std::vector<Frame> stack_;
+
+    /** Walks everything pushed above `bottom`, leaves the stack as it was below it so walks can nest */
+    void run(const size_t bottom)
+    {
+        while (stack_.size() > bottom)
+        {
+            auto& frame = stack_.back();
+            const auto node = frame.node;
+            if (frame.entered)
+            {
+                stack_.pop_back();
+                leave(*node);
+                continue;
+            }
+
+            frame.entered = true;
+
+            // the enter dispatch also pushes the node's children
+            const auto first_child = stack_.size();
+            derived().enter_node(*node);
+            dispatch<false>(*node);
+            if (stack_.size() == first_child)
+            {
+                // leaves are left straight away instead of coming back around the loop
+                stack_.pop_back();
+                leave(*node);
+            }
+        }
+    }
+
+    void leave(SyntaxNode& node)
+    {
+        dispatch<true>(node);
+        derived().leave_node(node);
+    }
+
+    /** Calls the node's `leave_*` hook, or its `enter_*` hook and then pushes its children */
+    template <bool Leaving>
+    void dispatch(SyntaxNode& node)
+    {
+        switch (node.kind)
+        {
+            FOR_EACH_WALKED_NODE(DISPATCH_WALKER_HOOK)
+            default:
+                report_compiler_error("AstWalker got a node it can't walk: " + std::string(node.get_text()));
+        }
+    }
+
+    void push(SyntaxNode* node)
+    {
+        stack_.push_back({ node, false });
+    }
+
+    template <typename Node>
+    void push(const std::optional<Node*>& node)
+    {
+        if (node.has_value())
+            push(*node);
+    }
+
+    template <typename Node>
+    void push_all(const std::vector<Node*>& nodes)
+    {
+        for (auto it = nodes.rbegin(); it != nodes.rend(); ++it)
+            push(*it);
+    }
+
+    void push_type_list_clause(const std::optional<TypeListClause*>& type_list)
+    {
+        if (type_list.has_value())
+            push_all(type_list.value()->list);
+    }
+
+    void push_colon_type_clause(const std::optional<ColonTypeClause*>& colon_type)
+    {
+        if (colon_type.has_value())
+            push(colon_type.value()->type);
+    }
+
+    void push_equals_value_clause(const std::optional<EqualsValueClause*>& equals_value)
+    {
+        if (equals_value.has_value())
+            push(equals_value.value()->value);
+    }
+
+    void push_function_body(const FunctionBody* function_body)
+    {
+        if (function_body->block.has_value())
+            push(*function_body->block);
+        else
+            push(function_body->expression_body.value()->expression);
+    }
+
+    /** Nodes without an overload below have no children. Children are pushed last first so the first is walked first */
+    template <typename Node>
+    void push_children(Node&)
+    {
+    }
+
+    void push_children(ArrayLiteral& array_literal)
+    {
+        push_all(array_literal.elements);
+    }
+
+    void push_children(TupleLiteral& tuple_literal)
+    {
+        push_all(tuple_literal.elements);
+    }
+
+    void push_children(RangeLiteral& range_literal)
+    {
+        push(range_literal.maximum);
+        push(range_literal.minimum);
+    }
+
+    void push_children(RgbLiteral& rgb_literal)
+    {
+        push(rgb_literal.b);
+        push(rgb_literal.g);
+        push(rgb_literal.r);
+    }
+
+    void push_children(HsvLiteral& hsv_literal)
+    {
+        push(hsv_literal.v);
+        push(hsv_literal.s);
+        push(hsv_literal.h);
+    }
+
+    void push_children(VectorLiteral& vector_literal)
+    {
+        push(vector_literal.z);
+        push(vector_literal.y);
+        push(vector_literal.x);
+    }
+
+    void push_children(InterpolatedString& interpolated_string)
+    {
+        push_all(interpolated_string.interpolations);
+    }
+
+    void push_children(Parenthesized& parenthesized)
+    {
+        push(parenthesized.expression);
+    }
+
+    void push_children(BinaryOp& binary_op)
+    {
+        push(binary_op.right);
+        push(binary_op.left);
+    }
+
+    void push_children(AssignmentOp& assignment_op)
+    {
+        push_children(static_cast<BinaryOp&>(assignment_op));
+    }
+
+    void push_children(UnaryOp& unary_op)
+    {
+        push(unary_op.operand);
+    }
+
+    void push_children(PostfixUnaryOp& postfix_unary_op)
+    {
+        push(postfix_unary_op.operand);
+    }
+
+    void push_children(TernaryOp& ternary_op)
+    {
+        push(ternary_op.when_false);
+        push(ternary_op.when_true);
+        push(ternary_op.condition);
+    }
+
+    void push_children(Invocation& invocation)
+    {
+        push_all(invocation.arguments);
+        push_type_list_clause(invocation.type_arguments);
+        push(invocation.callee);
+    }
+
+    void push_children(TypeOf& type_of)
+    {
+        push(type_of.expression);
+    }
+
+    void push_children(Await& await)
+    {
+        push(await.expression);
+    }
+
+    void push_children(MemberAccess& member_access)
+    {
+        push(member_access.expression);
+    }
+
+    void push_children(OptionalMemberAccess& optional_member_access)
+    {
+        push(optional_member_access.expression);
+    }
+
+    void push_children(ElementAccess& element_access)
+    {
+        push(element_access.index_expression);
+        push(element_access.expression);
+    }
+
+    void push_children(ExpressionStatement& expression_statement)
+    {
+        push(expression_statement.expression);
+    }
+
+    void push_children(Block& block)
+    {
+        push_all(block.braced_statement_list->statements);
+    }
+
+    void push_children(TypeDeclaration& type_declaration)
+    {
+        push(type_declaration.type);
+        push_type_list_clause(type_declaration.type_parameters);
+    }
+
+    void push_children(VariableDeclaration& variable_declaration)
+    {
+        push_equals_value_clause(variable_declaration.equals_value);
+        push_colon_type_clause(variable_declaration.colon_type);
+    }
+
+    void push_children(EventDeclaration& event_declaration)
+    {
+        push_all(event_declaration.parameter_types);
+        push_type_list_clause(event_declaration.type_parameters);
+    }
+
+    void push_children(InterfaceDeclaration& interface_declaration)
+    {
+        push_all(interface_declaration.members->statements);
+    }
+
+    void push_children(EnumDeclaration& enum_declaration)
+    {
+        push_all(enum_declaration.members->statements);
+    }
+
+    void push_children(FunctionDeclaration& function_declaration)
+    {
+        push_function_body(function_declaration.body);
+        push_colon_type_clause(function_declaration.return_type);
+        if (function_declaration.parameters.has_value())
+            push_all(function_declaration.parameters.value()->list);
+        push_type_list_clause(function_declaration.type_parameters);
+    }
+
+    void push_children(Parameter& parameter)
+    {
+        push_equals_value_clause(parameter.equals_value);
+        push_colon_type_clause(parameter.colon_type);
+    }
+
+    void push_children(InstanceConstructor& instance_constructor)
+    {
+        push(instance_constructor.parent);
+        if (instance_constructor.declarators.has_value())
+            push_all(instance_constructor.declarators.value()->statements);
+        push_colon_type_clause(instance_constructor.colon_type);
+    }
+
+    void push_children(InstancePropertyDeclarator& instance_property_declarator)
+    {
+        push(instance_property_declarator.value);
+    }
+
+    void push_children(InstanceAttributeDeclarator& instance_attribute_declarator)
+    {
+        push(instance_attribute_declarator.value);
+    }
+
+    void push_children(Return& return_statement)
+    {
+        push(return_statement.expression);
+    }
+
+    void push_children(If& if_statement)
+    {
+        push(if_statement.else_branch);
+        push(if_statement.then_branch);
+        push(if_statement.condition);
+    }
+
+    void push_children(While& while_statement)
+    {
+        push(while_statement.statement);
+        push(while_statement.condition);
+    }
+
+    void push_children(Repeat& repeat_statement)
+    {
+        push(repeat_statement.condition);
+        push(repeat_statement.statement);
+    }
+
+    void push_children(For& for_statement)
+    {
+        push(for_statement.statement);
+        push(for_statement.iterable);
+    }
+
+    void push_children(After& after_statement)
+    {
+        push(after_statement.statement);
+        push(after_statement.time_expression);
+    }
+
+    void push_children(Every& every_statement)
+    {
+        push(every_statement.statement);
+        push(every_statement.condition);
+        push(every_statement.time_expression);
+    }
+
+    void push_children(Match& match_statement)
+    {
+        push_all(match_statement.cases->statements);
+        push(match_statement.expression);
+    }
+
+    void push_children(MatchCase& match_case)
+    {
+        push(match_case.statement);
+        push_all(match_case.comparands);
+    }
+
+    void push_children(MatchElseCase& match_else_case)
+    {
+        push(match_else_case.statement);
+    }
+
+    void push_children(Export& export_statement)
+    {
+        push(export_statement.statement);
+    }
+
+    void push_children(Decorator& decorator)
+    {
+        push_all(decorator.arguments);
+    }
+
+    void push_children(NullableTypeRef& nullable_type)
+    {
+        push(nullable_type.non_nullable_type);
+    }
+
+    void push_children(ArrayTypeRef& array_type)
+    {
+        push(array_type.element_type);
+    }
+
+    void push_children(TupleTypeRef& tuple_type)
+    {
+        push_all(tuple_type.element_types);
+    }
+
+    void push_children(FunctionTypeRef& function_type)
+    {
+        push(function_type.return_type);
+        push_all(function_type.parameter_types);
+        push_type_list_clause(function_type.type_parameters);
+    }
+
+    void push_children(UnionTypeRef& union_type)
+    {
+        push_all(union_type.types);
+    }
+
+    void push_children(IntersectionTypeRef& intersection_type)
+    {
+        push_all(intersection_type.types);
+    }
+
+    void push_children(TypeParameterRef& type_parameter)
+    {
+        push(type_parameter.default_type);
+        push(type_parameter.base_type);
+    }
+};
@@ -0,0 +1,76 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * Bump allocator that owns every AST node and clause of a source file. Nothing in it is freed individually,
+ * everything is destroyed at once (in reverse order of creation) when the arena is.
+ */
+class AstArena
+{
+    static constexpr size_t chunk_size = 64 * 1024;
+
+    struct Finalizer
+    {
+        void (*destroy)(void*);
+        void* object;
+        Finalizer* previous;
+    };
+
+    std::vector<std::unique_ptr<std::byte[]>> chunks_;
+    size_t chunk_used_ = 0;
+    size_t chunk_capacity_ = 0;
+    Finalizer* last_finalizer_ = nullptr;
+    size_t object_count_ = 0;
+    size_t reserved_bytes_ = 0;
+
+    [[nodiscard]] void* allocate(size_t size, size_t alignment);
+    void release();
+
+public:
+    AstArena() = default;
+    ~AstArena();
+    AstArena(AstArena&&) noexcept;
+    AstArena& operator=(AstArena&&) noexcept;
+    AstArena(const AstArena&) = delete;
+    AstArena& operator=(const AstArena&) = delete;
+
+    /** Constructs a `T` in the arena, it lives for as long as the arena does */
+    template <typename T, typename... Args>
+    T* create(Args&&... args)
+    {
+        const auto object = new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+            const auto finalizer = static_cast<Finalizer*>(allocate(sizeof(Finalizer), alignof(Finalizer)));
+            *finalizer = { [](void* destroyed) { static_cast<T*>(destroyed)->~T(); }, object, last_finalizer_ };
+            last_finalizer_ = finalizer;
+        }
+
+        object_count_++;
+        return object;
+    }
+
+    [[nodiscard]] size_t object_count() const;
+    /** Bytes reserved for chunks, including the unused end of each */
+    [[nodiscard]] size_t memory_usage() const;
+
+    /** The arena that nodes created on this thread are allocated in, set by `AstArenaScope` */
+    static AstArena& current();
+};
+
+/** Makes `arena` the current one on this thread until the scope ends */
+class AstArenaScope
+{
+    AstArena* previous_;
+
+public:
+    explicit AstArenaScope(AstArena& arena);
+    ~AstArenaScope();
+    AstArenaScope(const AstArenaScope&) = delete;
+    AstArenaScope& operator=(const AstArenaScope&) = delete;
+};
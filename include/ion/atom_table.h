@@ -0,0 +1,50 @@
+#pragma once
+#include <cstdint>
+#include <limits>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "string_arena.h"
+
+/** Interned identifier spelling, two atoms are equal exactly when their spellings are */
+using atom_t = uint32_t;
+/** Stands in for the atom of tokens that aren't identifiers */
+constexpr atom_t no_atom = std::numeric_limits<atom_t>::max();
+
+/**
+ * Hands out stable 32-bit atoms for identifier spellings, so that scopes and symbols can compare names as integers.
+ * Safe to use from multiple threads (chunks of a file are lexed in parallel).
+ */
+class AtomTable
+{
+    mutable std::shared_mutex mutex_;
+    StringArena spellings_arena_;
+    std::vector<std::string_view> spellings_;
+    std::unordered_map<std::string_view, atom_t> atoms_;
+
+public:
+    AtomTable() = default;
+    AtomTable(const AtomTable&) = delete;
+    AtomTable& operator=(const AtomTable&) = delete;
+
+    /** Returns the atom of `spelling`, interning it if it's new */
+    [[nodiscard]] atom_t intern(std::string_view spelling);
+    /** Returns the spelling of `atom`, the view stays valid for as long as the table does */
+    [[nodiscard]] std::string_view get_spelling(atom_t atom) const;
+    [[nodiscard]] size_t size() const;
+
+    /** The table used for the whole compilation */
+    static AtomTable& global();
+};
+
+inline atom_t intern(const std::string_view spelling)
+{
+    return AtomTable::global().intern(spelling);
+}
+
+inline std::string_view get_spelling(const atom_t atom)
+{
+    return AtomTable::global().get_spelling(atom);
+}
@@ -6,6 +6,8 @@
 struct Compiler
 {
     std::vector<SourceFile> files;
+    /** Dumps each file's AST once it's parsed */
+    bool view_ast = true;
 
     explicit Compiler(std::vector<SourceFile> files)
         : files(std::move(files))
@@ -20,10 +22,14 @@ struct Compiler
     void emit();
 
 private:
+    void run_phase(void (*)(SourceFile&));
+    static void parse_file(SourceFile&);
+    static void view(const SourceFile&);
     static void pre_emit(SourceFile&);
+    static void write_symbols(const SourceFile&);
     static void emit(SourceFile&);
 };
 
-void compile_files(std::vector<SourceFile>&);
-void compile_file(const std::string&);
-void compile_file(SourceFile&);
\ No newline at end of file
+void compile_files(std::vector<SourceFile>&, bool view_ast = true);
+void compile_file(const std::string&, bool view_ast = true);
+void compile_file(SourceFile&, bool view_ast = true);
\ No newline at end of file
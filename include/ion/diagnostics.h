@@ -1,6 +1,7 @@
 #pragma once
 #include <cstdint>
 #include <variant>
+#include <vector>
 #include <string>
 
 #include "diagnostics_macros.h"
@@ -65,6 +66,8 @@ EMPTY_DIAGNOSTIC(VariableReadInOwnInitializer);
 
 EMPTY_DIAGNOSTIC(NoVariableTypeOrInitializer);
 
+EMPTY_DIAGNOSTIC(NestingTooDeep);
+
 using diagnostic_data_t = std::variant<
     UnexpectedCharacter,
     MalformedNumber,
@@ -85,6 +88,7 @@ using diagnostic_data_t = std::variant<
     InvalidAwait,
     DuplicateField,
     NoVariableTypeOrInitializer,
+    NestingTooDeep,
     UnreachableCode,
     AmbiguousEquals
 >;
@@ -97,6 +101,29 @@ struct Diagnostic
     diagnostic_data_t data;
 };
 
+/** Thrown instead of printing and exiting when an error is reported on a thread with an active `ErrorDeferral` */
+struct DeferredError
+{
+    std::string message;
+    uint8_t code;
+};
+
+/** While alive, errors reported on the current thread throw a `DeferredError` so another thread can decide which one to report */
+struct ErrorDeferral
+{
+    ErrorDeferral();
+    ~ErrorDeferral();
+    ErrorDeferral(const ErrorDeferral&) = delete;
+    ErrorDeferral& operator=(const ErrorDeferral&) = delete;
+
+private:
+    bool was_deferring;
+};
+
+/** Prints a deferred error and exits, exactly like it would have when it was first reported */
+[[noreturn]] void report_deferred_error(const DeferredError&);
+/** Prints every deferred error and exits with the code of the first, or throws the first if errors are being deferred */
+[[noreturn]] void report_deferred_errors(const std::vector<DeferredError>&);
 [[noreturn]] void report_compiler_error(const std::string&);
 [[noreturn]] void report_unexpected_character(const FileSpan&, char);
 [[noreturn]] void report_malformed_number(const FileSpan&, const std::string&);
@@ -130,6 +157,7 @@ GENERATE_ERROR_NODE_OVERLOADS_H(report_invalid_await);
 [[noreturn]] void report_duplicate_member(const FileSpan&, const std::string&);
 GENERATE_ERROR_NODE_OVERLOADS_H(report_no_variable_type_or_initializer);
 [[noreturn]] void report_no_variable_type_or_initializer(const FileSpan&);
+[[noreturn]] void report_nesting_too_deep(const FileSpan&);
 
 GENERATE_NODE_OVERLOADS_H(warn_unreachable_code);
 void warn_unreachable_code(const FileSpan&);
@@ -27,15 +27,15 @@ void fn(const Token& token);
 #define GENERATE_ERROR_NODE_OVERLOADS_WITH_TEXT(fn) \
 [[noreturn]] void fn(const expression_ptr_t& expression) \
 { \
-fn(expression->get_span(), expression->get_text()); \
+fn(expression->get_span(), std::string(expression->get_text())); \
 } \
 [[noreturn]] void fn(const statement_ptr_t& statement) \
 { \
-fn(statement->get_span(), statement->get_text()); \
+fn(statement->get_span(), std::string(statement->get_text())); \
 } \
 [[noreturn]] void fn(const Token& token) \
 { \
-fn(token.span, token.get_text()); \
+fn(token.span, std::string(token.get_text())); \
 }
 
 #define GENERATE_ERROR_NODE_OVERLOADS(fn) \
@@ -55,15 +55,15 @@ fn(token.span); \
 #define GENERATE_ERROR_NODE_OVERLOADS_WITH_TEXT(fn) \
 [[noreturn]] void fn(const expression_ptr_t& expression) \
 { \
-fn(expression->get_span(), expression->get_text()); \
+fn(expression->get_span(), std::string(expression->get_text())); \
 } \
 [[noreturn]] void fn(const statement_ptr_t& statement) \
 { \
-fn(statement->get_span(), statement->get_text()); \
+fn(statement->get_span(), std::string(statement->get_text())); \
 } \
 [[noreturn]] void fn(const Token& token) \
 { \
-fn(token.span, token.get_text()); \
+fn(token.span, std::string(token.get_text())); \
 }
 
 #define GENERATE_NODE_OVERLOADS(fn) \
@@ -83,13 +83,13 @@ fn(token.span); \
 #define GENERATE_NODE_OVERLOADS_WITH_TEXT(fn) \
 void fn(const expression_ptr_t& expression) \
 { \
-fn(expression->get_span(), expression->get_text()); \
+fn(expression->get_span(), std::string(expression->get_text())); \
 } \
 void fn(const statement_ptr_t& statement) \
 { \
-fn(statement->get_span(), statement->get_text()); \
+fn(statement->get_span(), std::string(statement->get_text())); \
 } \
 void fn(const Token& token) \
 { \
-fn(token.span, token.get_text()); \
+fn(token.span, std::string(token.get_text())); \
 }
\ No newline at end of file
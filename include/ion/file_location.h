@@ -1,5 +1,6 @@
 #pragma once
 #include <string>
+#include <string_view>
 
 struct Token;
 struct SourceFile;
@@ -78,8 +79,8 @@ struct FileSpan
     FileLocation start;
     FileLocation end;
 
-    [[nodiscard]] std::string get_text() const;
-    [[nodiscard]] std::string get_line() const;
+    [[nodiscard]] std::string_view get_text() const;
+    [[nodiscard]] std::string_view get_line() const;
     [[nodiscard]] bool has_line_break_between(const Token& other) const;
     [[nodiscard]] bool has_line_break_between(const FileSpan& other) const;
 
@@ -13,9 +13,15 @@ static named_symbol_ptr_t create_print_symbol()
                                                               std::move(print_fn_parameters),
                                                               void_type.as_shared());
 
-    return std::make_shared<NamedSymbol>("print", std::move(print_fn_type));
+    return std::make_shared<NamedSymbol>(intern("print"), std::move(print_fn_type));
 }
 
-const std::vector intrinsic_symbols {
-    create_print_symbol()
-};
\ No newline at end of file
+/** Symbols every file can use without declaring them. Passes may attach types to symbols, so each thread gets its own */
+inline const std::vector<named_symbol_ptr_t>& get_intrinsic_symbols()
+{
+    thread_local const std::vector symbols {
+        create_print_symbol()
+    };
+
+    return symbols;
+}
\ No newline at end of file
@@ -0,0 +1,9 @@
+#pragma once
+#include <cstddef>
+#include <functional>
+
+/**
+ * Runs `task` on a new thread with a stack of `stack_size` bytes and waits for it to finish, rethrowing anything it
+ * throws. Thread-local state (e.g. the current AST arena) isn't carried over, `task` has to set up what it needs.
+ */
+void run_with_stack_size(size_t stack_size, const std::function<void ()>& task);
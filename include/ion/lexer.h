@@ -1,105 +1,118 @@
 #pragma once
+#include <array>
+#include <string_view>
 
 #include "token.h"
+#include "token_table.h"
 #include "utility/basic.h"
 #include "utility/lexer.h"
 
-struct OperatorRule
+constexpr auto operator_syntaxes = std::to_array<std::pair<std::string_view, SyntaxKind>>({
+    { "+", SyntaxKind::Plus },
+    { "++", SyntaxKind::PlusPlus },
+    { "+=", SyntaxKind::PlusEquals },
+    { "-", SyntaxKind::Minus },
+    { "--", SyntaxKind::MinusMinus },
+    { "-=", SyntaxKind::MinusEquals },
+    { "->", SyntaxKind::LongArrow },
+    { "*", SyntaxKind::Star },
+    { "*=", SyntaxKind::StarEquals },
+    { "/", SyntaxKind::Slash },
+    { "/=", SyntaxKind::SlashEquals },
+    { "//", SyntaxKind::SlashSlash },
+    { "//=", SyntaxKind::SlashSlashEquals },
+    { "^", SyntaxKind::Caret },
+    { "^=", SyntaxKind::CaretEquals },
+    { "%", SyntaxKind::Percent },
+    { "%=", SyntaxKind::PercentEquals },
+    { "&", SyntaxKind::Ampersand },
+    { "&=", SyntaxKind::AmpersandEquals },
+    { "&&", SyntaxKind::AmpersandAmpersand },
+    { "&&=", SyntaxKind::AmpersandAmpersandEquals },
+    { "|", SyntaxKind::Pipe },
+    { "|=", SyntaxKind::PipeEquals },
+    { "||", SyntaxKind::PipePipe },
+    { "||=", SyntaxKind::PipePipeEquals },
+    { "~", SyntaxKind::Tilde },
+    { "~=", SyntaxKind::TildeEquals },
+    { "<", SyntaxKind::LArrow },
+    { "<=", SyntaxKind::LArrowEquals },
+    { "<<", SyntaxKind::LArrowLArrow },
+    { "<<=", SyntaxKind::LArrowLArrowEquals },
+    { ">", SyntaxKind::RArrow },
+    { ">=", SyntaxKind::RArrowEquals },
+    { ">>", SyntaxKind::RArrowRArrow },
+    { ">>=", SyntaxKind::RArrowRArrowEquals },
+    { ">>>", SyntaxKind::RArrowRArrowRArrow },
+    { ">>>=", SyntaxKind::RArrowRArrowRArrowEquals },
+    { "!", SyntaxKind::Bang },
+    { "!=", SyntaxKind::BangEquals },
+    { "=", SyntaxKind::Equals },
+    { "==", SyntaxKind::EqualsEquals },
+    { "?", SyntaxKind::Question },
+    { "\?\?", SyntaxKind::QuestionQuestion },
+    { "\?\?=", SyntaxKind::QuestionQuestionEquals },
+    { ".", SyntaxKind::Dot },
+    { "..", SyntaxKind::DotDot },
+    { ":", SyntaxKind::Colon },
+    { "::", SyntaxKind::ColonColon }
+});
+
+/**
+ * Maximal munch DFA over `operator_syntaxes`, built at compile time.
+ * State 0 is the start state and a transition to state 0 means there is no transition.
+ */
+struct OperatorDfa
 {
-    SyntaxKind base;
-    std::vector<std::pair<std::string, SyntaxKind>> continuations;
+    static constexpr size_t state_count = operator_syntaxes.size() + 1;
+
+    std::array<std::array<unsigned char, 256>, state_count> transitions {};
+    std::array<SyntaxKind, state_count> accepted_kinds {};
+    std::array<bool, state_count> accepting {};
 };
 
-static const std::unordered_map<char, OperatorRule> operator_rules = {
-    {
-        '+', {
-            SyntaxKind::Plus,
-            {
-                { "++", SyntaxKind::PlusPlus },
-                { "+=", SyntaxKind::PlusEquals }
-            }
-        }
-    },
-    {
-        '-', {
-            SyntaxKind::Minus,
-            {
-                { "--", SyntaxKind::MinusMinus },
-                { "-=", SyntaxKind::MinusEquals },
-                { "->", SyntaxKind::LongArrow },
-            }
-        }
-    },
-    { '*', { SyntaxKind::Star, { { "*=", SyntaxKind::StarEquals } } } },
-    {
-        '/', {
-            SyntaxKind::Slash,
-            {
-                { "/=", SyntaxKind::SlashEquals },
-                { "//=", SyntaxKind::SlashSlashEquals },
-                { "//", SyntaxKind::SlashSlash }
-            }
-        }
-    },
-    { '^', { SyntaxKind::Caret, { { "^=", SyntaxKind::CaretEquals } } } },
-    { '%', { SyntaxKind::Percent, { { "%=", SyntaxKind::PercentEquals } } } },
-    {
-        '&', {
-            SyntaxKind::Ampersand,
-            {
-                { "&=", SyntaxKind::AmpersandEquals },
-                { "&&=", SyntaxKind::AmpersandAmpersandEquals },
-                { "&&", SyntaxKind::AmpersandAmpersand }
-            }
-        }
-    },
-    {
-        '|', {
-            SyntaxKind::Pipe,
-            {
-                { "|=", SyntaxKind::PipeEquals },
-                { "||=", SyntaxKind::PipePipeEquals },
-                { "||", SyntaxKind::PipePipe }
-            }
-        }
-    },
-    { '~', { SyntaxKind::Tilde, { { "~=", SyntaxKind::TildeEquals } } } },
-    {
-        '<', {
-            SyntaxKind::LArrow,
-            {
-                { "<=", SyntaxKind::LArrowEquals },
-                { "<<=", SyntaxKind::LArrowLArrowEquals },
-                { "<<", SyntaxKind::LArrowLArrow }
-            }
-        }
-    },
+constexpr auto operator_dfa = []
+{
+    OperatorDfa dfa;
+    unsigned char next_free_state = 1;
+    for (const auto& [lexeme, kind] : operator_syntaxes)
     {
-        '>', {
-            SyntaxKind::RArrow,
-            {
-                { ">=", SyntaxKind::RArrowEquals },
-                { ">>>=", SyntaxKind::RArrowRArrowRArrowEquals },
-                { ">>>", SyntaxKind::RArrowRArrowRArrow },
-                { ">>=", SyntaxKind::RArrowRArrowEquals },
-                { ">>", SyntaxKind::RArrowRArrow }
-            }
+        unsigned char state = 0;
+        for (const auto character : lexeme)
+        {
+            auto& next_state = dfa.transitions[state][static_cast<unsigned char>(character)];
+            if (next_state == 0)
+                next_state = next_free_state++;
+
+            state = next_state;
         }
-    },
-    { '!', { SyntaxKind::Bang, { { "!=", SyntaxKind::BangEquals } } } },
-    { '=', { SyntaxKind::Equals, { { "==", SyntaxKind::EqualsEquals } } } },
+
+        dfa.accepted_kinds[state] = kind;
+        dfa.accepting[state] = true;
+    }
+
+    return dfa;
+}();
+
+// every prefix of an operator is an operator itself, so the lexer never has to backtrack to the last accepting state
+static_assert(std::ranges::all_of(operator_syntaxes, [](const auto& pair)
+{
+    unsigned char state = 0;
+    for (const auto character : pair.first)
     {
-        '\?', {
-            SyntaxKind::Question,
-            {
-                { "\?\?=", SyntaxKind::QuestionQuestionEquals },
-                { "\?\?", SyntaxKind::QuestionQuestion },
-            }
-        }
-    },
-    { '.', { SyntaxKind::Dot, { { "..", SyntaxKind::DotDot } } } },
-    { ':', { SyntaxKind::Colon, { { "::", SyntaxKind::ColonColon } } } },
-};
+        state = operator_dfa.transitions[state][static_cast<unsigned char>(character)];
+        if (!operator_dfa.accepting[state])
+            return false;
+    }
+
+    return operator_dfa.accepted_kinds[state] == pair.second;
+}), "operator_syntaxes must be prefix-closed");
+
+/** Returns the DFA state after reading `character` from the start state, or 0 if no operator starts with it */
+constexpr unsigned char operator_start_state(const char character)
+{
+    return operator_dfa.transitions[0][static_cast<unsigned char>(character)];
+}
 
 const std::unordered_map<char, SyntaxKind> single_character_syntaxes = {
     { ';', SyntaxKind::Semicolon },
@@ -116,7 +129,7 @@ const std::unordered_map<char, SyntaxKind> single_character_syntaxes = {
 
 const auto single_character_lexemes = inverse_map(single_character_syntaxes);
 
-const std::unordered_map<std::string, SyntaxKind> keyword_syntaxes = {
+constexpr std::array<std::pair<std::string_view, SyntaxKind>, 32> keyword_syntaxes = { {
     { "let", SyntaxKind::LetKeyword },
     { "const", SyntaxKind::ConstKeyword },
     { "fn", SyntaxKind::FnKeyword },
@@ -149,12 +162,149 @@ const std::unordered_map<std::string, SyntaxKind> keyword_syntaxes = {
     { "null", SyntaxKind::NullKeyword },
     { "rgb", SyntaxKind::RgbKeyword },
     { "hsv", SyntaxKind::HsvKeyword }
-};
+} };
+
+const auto keyword_lexemes = []
+{
+    std::unordered_map<SyntaxKind, std::string> map;
+    for (const auto& [lexeme, kind] : keyword_syntaxes)
+        map.emplace(kind, lexeme);
+
+    return map;
+}();
+
+/** Returns the keyword kind of `text` if it is one, dispatching on its length and first character so no hashing is involved */
+constexpr std::optional<SyntaxKind> find_keyword(const std::string_view text)
+{
+    const auto keyword = [&](const std::string_view lexeme, const SyntaxKind kind) -> std::optional<SyntaxKind>
+    {
+        if (text == lexeme)
+            return kind;
 
-const auto keyword_lexemes = inverse_map(keyword_syntaxes);
+        return std::nullopt;
+    };
+
+    switch (text.size())
+    {
+        case 2:
+            switch (text[0])
+            {
+                case 'f': return keyword("fn", SyntaxKind::FnKeyword);
+                case 'i': return keyword("if", SyntaxKind::IfKeyword);
+                default: return std::nullopt;
+            }
+        case 3:
+            switch (text[0])
+            {
+                case 'l': return keyword("let", SyntaxKind::LetKeyword);
+                case 'f': return keyword("for", SyntaxKind::ForKeyword);
+                case 'r': return keyword("rgb", SyntaxKind::RgbKeyword);
+                case 'h': return keyword("hsv", SyntaxKind::HsvKeyword);
+                default: return std::nullopt;
+            }
+        case 4:
+            switch (text[0])
+            {
+                case 'e':
+                    if (text[1] == 'l')
+                        return keyword("else", SyntaxKind::ElseKeyword);
+
+                    return keyword("enum", SyntaxKind::EnumKeyword);
+                case 't':
+                    if (text[1] == 'y')
+                        return keyword("type", SyntaxKind::TypeKeyword);
+
+                    return keyword("true", SyntaxKind::TrueKeyword);
+                case 'f': return keyword("from", SyntaxKind::FromKeyword);
+                case 'n': return keyword("null", SyntaxKind::NullKeyword);
+                default: return std::nullopt;
+            }
+        case 5:
+            switch (text[0])
+            {
+                case 'a':
+                    if (text[1] == 's')
+                        return keyword("async", SyntaxKind::AsyncKeyword);
+                    if (text[1] == 'w')
+                        return keyword("await", SyntaxKind::AwaitKeyword);
+
+                    return keyword("after", SyntaxKind::AfterKeyword);
+                case 'c':
+                    if (text[1] == 'o')
+                        return keyword("const", SyntaxKind::ConstKeyword);
+
+                    return keyword("clone", SyntaxKind::CloneKeyword);
+                case 'e':
+                    if (text[3] == 'n')
+                        return keyword("event", SyntaxKind::EventKeyword);
+
+                    return keyword("every", SyntaxKind::EveryKeyword);
+                case 'b': return keyword("break", SyntaxKind::BreakKeyword);
+                case 'w': return keyword("while", SyntaxKind::WhileKeyword);
+                case 'm': return keyword("match", SyntaxKind::MatchKeyword);
+                case 'f': return keyword("false", SyntaxKind::FalseKeyword);
+                default: return std::nullopt;
+            }
+        case 6:
+            switch (text[0])
+            {
+                case 'r':
+                    if (text[2] == 't')
+                        return keyword("return", SyntaxKind::ReturnKeyword);
+
+                    return keyword("repeat", SyntaxKind::RepeatKeyword);
+                case 't': return keyword("typeof", SyntaxKind::TypeOfKeyword);
+                case 'n': return keyword("nameof", SyntaxKind::NameOfKeyword);
+                case 'i': return keyword("import", SyntaxKind::ImportKeyword);
+                case 'e': return keyword("export", SyntaxKind::ExportKeyword);
+                default: return std::nullopt;
+            }
+        case 8:
+            switch (text[0])
+            {
+                case 'c': return keyword("continue", SyntaxKind::ContinueKeyword);
+                case 'i': return keyword("instance", SyntaxKind::InstanceKeyword);
+                default: return std::nullopt;
+            }
+        case 9:
+            return keyword("interface", SyntaxKind::InterfaceKeyword);
+        default:
+            return std::nullopt;
+    }
+}
+
+static_assert(std::ranges::all_of(keyword_syntaxes, [](const auto& pair)
+{
+    return find_keyword(pair.first) == pair.second;
+}), "find_keyword() is out of sync with keyword_syntaxes");
+
+/** Files at least this big are split into chunks that are lexed in parallel */
+constexpr size_t parallel_lexing_threshold = 4 * 1024 * 1024;
+/** Smallest chunk worth handing to another thread */
+constexpr size_t min_lexing_chunk_size = 1024 * 1024;
 
 static void lex(LexState&);
-std::vector<Token> tokenize(const SourceFile&);
+/** Lexes until at least one token has been pushed to `state.tokens`, returns false if the file ended first */
+bool lex_next(LexState&);
+/** How many chunks `file` is lexed as, more than one only if it's at least `parallel_lexing_threshold` big and there are threads to lex them on */
+size_t lexing_chunk_count(const SourceFile& file);
+TokenTable tokenize(const SourceFile&);
+/** Lexes `file` as (up to) `chunk_count` chunks in parallel, the result is identical to lexing it sequentially */
+TokenTable tokenize_chunked(const SourceFile&, size_t chunk_count);
+
+/** Which tokens of a table were replaced by `relex()` */
+struct TokenSplice
+{
+    token_index_t first;
+    size_t removed_count;
+    size_t inserted_count;
+};
+
+/**
+ * Applies `edit` to `file` and updates `tokens` (previously lexed from it) to match, re-lexing only from the last
+ * token boundary before the edit that lexing can restart at, until the new tokens line up with the old ones again.
+ */
+TokenSplice relex(SourceFile&, TokenTable& tokens, const SourceEdit&);
 
 inline std::optional<std::string> syntax_to_string(const SyntaxKind kind)
 {
@@ -3,6 +3,9 @@
 
 namespace logger
 {
+    /** Writes `line` to stdout as a whole, lines written by different threads never interleave */
+    void write_line(const std::string& line);
+
     void info(const std::string&);
     void warn(const std::string&);
     [[noreturn]] void error(const std::string& message, uint8_t code = 1);
@@ -1,5 +1,5 @@
 #pragma once
-#include <set>
+#include <functional>
 
 #include "ion/token.h"
 #include "ion/ast/ast.h"
@@ -26,11 +26,3 @@ auto parse_optional(ParseState& state, SyntaxKind kind, F&& parser) -> std::opti
 
     return std::nullopt;
 }
-
-expression_ptr_t parse_binary_expression(ParseState&, const std::function<expression_ptr_t(ParseState&)>&, SyntaxKind);
-expression_ptr_t parse_binary_expression(ParseState&, const std::function<expression_ptr_t (ParseState&)>&, const std::set<SyntaxKind>&);
-
-#define DEFINE_BINARY_PARSER(name, subparser, ops) \
-    static expression_ptr_t name(ParseState& state) { \
-        return parse_binary_expression(state, subparser, ops); \
-    }
\ No newline at end of file
@@ -1,4 +1,5 @@
 #pragma once
+#include <array>
 #include <memory>
 #include <vector>
 #include <set>
@@ -12,34 +13,61 @@
 #include "ion/ast/node.h"
 #include "ion/ast/ast.h"
 
-const std::set<std::string> primitive_type_names = { "number", "string", "bool", "void" };
-const std::set primitive_literal_syntaxes = {
+const std::set<std::string_view> primitive_type_names = { "number", "string", "bool", "void" };
+constexpr SyntaxKindSet primitive_literal_syntaxes = {
     SyntaxKind::TrueKeyword, SyntaxKind::FalseKeyword, SyntaxKind::NumberLiteral, SyntaxKind::StringLiteral
 };
 
-const std::set type_argument_syntaxes = {
+constexpr SyntaxKindSet type_argument_syntaxes = {
     SyntaxKind::Identifier,
     SyntaxKind::LArrow,
     SyntaxKind::RArrow, SyntaxKind::RArrowRArrow, SyntaxKind::RArrowRArrowRArrow,
     SyntaxKind::Comma
 };
 
-const std::set member_access_syntaxes = { SyntaxKind::Dot, SyntaxKind::ColonColon, SyntaxKind::At };
-const std::set postfix_op_syntaxes = { SyntaxKind::PlusPlus, SyntaxKind::MinusMinus };
-const std::set unary_syntaxes = { SyntaxKind::Bang, SyntaxKind::Tilde, SyntaxKind::Minus };
-const std::set multiplicative_syntaxes = { SyntaxKind::Star, SyntaxKind::Slash, SyntaxKind::SlashSlash, SyntaxKind::Percent };
-const std::set additive_syntaxes = { SyntaxKind::Plus, SyntaxKind::Minus };
-const std::set bit_shift_syntaxes = { SyntaxKind::LArrowLArrow, SyntaxKind::RArrowRArrow, SyntaxKind::RArrowRArrowRArrow };
-const std::set comparison_syntaxes = {
-    SyntaxKind::EqualsEquals,
-    SyntaxKind::BangEquals,
-    SyntaxKind::LArrow,
-    SyntaxKind::LArrowEquals,
-    SyntaxKind::RArrow,
-    SyntaxKind::RArrowEquals
+constexpr SyntaxKindSet member_access_syntaxes = { SyntaxKind::Dot, SyntaxKind::ColonColon, SyntaxKind::At };
+constexpr SyntaxKindSet postfix_op_syntaxes = { SyntaxKind::PlusPlus, SyntaxKind::MinusMinus };
+constexpr SyntaxKindSet unary_syntaxes = { SyntaxKind::Bang, SyntaxKind::Tilde, SyntaxKind::Minus };
+
+/** How tightly a binary operator binds the operands to its left and right, zero for tokens that aren't binary operators */
+struct BindingPower
+{
+    uint8_t left = 0;
+    uint8_t right = 0;
 };
 
-const std::set assignment_syntaxes = {
+constexpr auto binary_binding_powers = []
+{
+    std::array<BindingPower, static_cast<size_t>(SyntaxKind::HsvKeyword) + 1> powers {};
+    uint8_t precedence = 0;
+    const auto add_level = [&](const std::initializer_list<SyntaxKind> kinds, const bool right_associative = false)
+    {
+        precedence += 2;
+        for (const auto kind : kinds)
+            powers[static_cast<size_t>(kind)] = { precedence, static_cast<uint8_t>(right_associative ? precedence : precedence + 1) };
+    };
+
+    // from the loosest to the tightest binding
+    add_level({ SyntaxKind::QuestionQuestion }, true);
+    add_level({ SyntaxKind::PipePipe });
+    add_level({ SyntaxKind::AmpersandAmpersand });
+    add_level({
+        SyntaxKind::EqualsEquals, SyntaxKind::BangEquals,
+        SyntaxKind::LArrow, SyntaxKind::LArrowEquals,
+        SyntaxKind::RArrow, SyntaxKind::RArrowEquals
+    });
+    add_level({ SyntaxKind::DotDot });
+    add_level({ SyntaxKind::Pipe });
+    add_level({ SyntaxKind::Tilde });
+    add_level({ SyntaxKind::Ampersand });
+    add_level({ SyntaxKind::LArrowLArrow, SyntaxKind::RArrowRArrow, SyntaxKind::RArrowRArrowRArrow });
+    add_level({ SyntaxKind::Plus, SyntaxKind::Minus });
+    add_level({ SyntaxKind::Star, SyntaxKind::Slash, SyntaxKind::SlashSlash, SyntaxKind::Percent });
+    add_level({ SyntaxKind::Caret }, true);
+    return powers;
+}();
+
+constexpr SyntaxKindSet assignment_syntaxes = {
     SyntaxKind::Equals,
     SyntaxKind::PlusEquals,
     SyntaxKind::MinusEquals,
@@ -58,4 +86,7 @@ const std::set assignment_syntaxes = {
     SyntaxKind::PipePipeEquals
 };
 
+/** Parses the file, recovering from syntax errors at statement boundaries and collecting them in `file.syntax_errors` */
+void parse_recovering(SourceFile&);
+/** Parses the file and reports every syntax error in it at once */
 void parse(SourceFile&);
\ No newline at end of file
@@ -1,8 +1,11 @@
 #pragma once
 #include <set>
+#include <unordered_map>
 
-#include "ion/ast/visitor.h"
+#include "ion/ast/walker.h"
 #include "ion/logger.h"
+#include "symbols/named_symbol.h"
+#include "symbols/declaration_symbol.h"
 
 #define ASSERT_CONTEXT(node, report_fn, ctx) \
     if (context != ctx) report_fn(node.get_span());
@@ -16,14 +19,23 @@
     set.insert(name)
 
 #define DUPLICATE_MEMBER_CHECK(node, set, field_type) \
-    const auto name = node.name.get_text(); \
+    const auto name = node.name.get_atom(); \
     DUPLICATE_MEMBER_CHECK_CUSTOM_NAME(node, set, field_type, name)
 
-#define DEFINE_LOOP_VISITOR(name, name_capitalized) \
-    void Resolver::visit_##name(name_capitalized& name##_statement) \
+#define DEFINE_LOOP_HOOKS(name, name_capitalized) \
+    void Resolver::enter_##name(name_capitalized&) \
     { \
-        ContextGuard loop(this, Context::Loop); \
-        AstVisitor::visit_##name(name##_statement); \
+        push_context(Context::Loop); \
+    } \
+    void Resolver::leave_##name(name_capitalized&) \
+    { \
+        pop_context(); \
+    }
+
+#define DEFINE_EMPTY_SYMBOL_HOOK(name, name_capitalized) \
+    void Resolver::enter_##name(name_capitalized& name) \
+    { \
+        bind_empty_symbol(name); \
     }
 
 enum class ResolverContext
@@ -37,13 +49,30 @@ enum class ResolverContext
 
 const std::set function_contexts = { ResolverContext::Function, ResolverContext::AsyncFunction };
 
-class Resolver final : public ScopedAstVisitor<void, std::unordered_map<std::string, bool>>
+/** What a scope knows about one of the names declared in it */
+struct ScopedName
+{
+    /** False until the declaration is complete, reading the name before then reads it in its own initializer */
+    bool defined = false;
+    /** Symbol that identifiers with this name bind to */
+    std::optional<named_symbol_ptr_t> symbol;
+    /** Symbol that type names with this name bind to */
+    std::optional<named_symbol_ptr_t> type_symbol;
+};
+
+using resolver_scope_t = std::unordered_map<atom_t, ScopedName>;
+
+/** Checks that every name is declared before it's used and binds symbols to nodes, in one traversal over one scope stack */
+class Resolver final : public AstWalker<Resolver>
 {
     using Context = ResolverContext;
-    std::set<std::string> used_interface_members = {};
-    std::set<std::string> used_instance_properties = {};
-    std::set<std::string> used_instance_attributes = {};
-    std::set<std::string> used_instance_tags = {};
+    std::vector<resolver_scope_t> scopes_;
+    /** Contexts to return to as the nodes that set the current one are left */
+    std::vector<Context> enclosing_contexts_;
+    std::set<atom_t> used_interface_members = {};
+    std::set<atom_t> used_instance_properties = {};
+    std::set<atom_t> used_instance_attributes = {};
+    std::set<atom_t> used_instance_tags = {};
 
 public:
     Context context = Context::Global;
@@ -53,46 +82,90 @@ public:
         logger::info("Created resolver");
     }
 
-    static bool is_declared_in_scope(const std::string&, const std::unordered_map<std::string, bool>&);
+    void push_scope();
+    void pop_scope();
+    void push_context(Context);
+    void pop_context();
 
     void define(const Token&);
-    void define(const std::string&);
+    void define(atom_t);
     void declare(const Token&);
-    void declare(const std::string&, const FileSpan&);
+    void declare(atom_t, const FileSpan&);
     void declare_define(const Token&);
-    void declare_define(const std::string&, const FileSpan&);
-    [[nodiscard]] bool is_defined(const std::string&) const;
+    void declare_define(atom_t, const FileSpan&);
+    [[nodiscard]] bool is_defined(atom_t) const;
     void resolve_name(const Token&) const;
-    void define_intrinsic_name(const std::string&);
-    void visit_ast(const std::vector<statement_ptr_t>& statements) override;
-
-    void visit_identifier(Identifier&) override;
-    void visit_await(Await&) override;
-
-    void visit_block(Block&) override;
-    void visit_type_declaration(TypeDeclaration&) override;
-    void visit_variable_declaration(VariableDeclaration&) override;
-    void visit_event_declaration(EventDeclaration&) override;
-    void visit_enum_declaration(EnumDeclaration&) override;
-    void visit_interface_declaration(InterfaceDeclaration&) override;
-    void visit_interface_field(InterfaceField&) override;
-    void visit_interface_method(InterfaceMethod&) override;
-    void visit_function_declaration(FunctionDeclaration&) override;
-    void visit_parameter(Parameter&) override;
-    void visit_instance_constructor(InstanceConstructor&) override;
-    void visit_instance_attribute_declarator(InstanceAttributeDeclarator&) override;
-    void visit_instance_name_declarator(InstanceNameDeclarator&) override;
-    void visit_instance_property_declarator(InstancePropertyDeclarator&) override;
-    void visit_instance_tag_declarator(InstanceTagDeclarator&) override;
-    void visit_break(Break&) override;
-    void visit_continue(Continue&) override;
-    void visit_return(Return&) override;
-    void visit_while(While&) override;
-    void visit_repeat(Repeat&) override;
-    void visit_for(For&) override;
-    void visit_every(Every&) override;
-    void visit_import(Import&) override;
-
-    void visit_type_name(TypeNameRef&) override;
-    void visit_type_parameter(TypeParameterRef&) override;
-};
\ No newline at end of file
+    void define_intrinsic_symbol(const named_symbol_ptr_t&);
+
+    void bind_declaration_symbol(NamedDeclaration*);
+    void bind_type_declaration_symbol(NamedDeclaration*, type_ptr_t&);
+    void bind_empty_symbol(SyntaxNode&);
+    /** Makes `symbol` what identifiers (or type names, for type symbols) named `name` in the current scope bind to */
+    void define_symbol(atom_t name, const named_symbol_ptr_t& symbol);
+    [[nodiscard]] std::optional<named_symbol_ptr_t> find_named_symbol(atom_t) const;
+    [[nodiscard]] std::optional<named_symbol_ptr_t> find_type_symbol(atom_t) const;
+
+    void walk_ast(const std::vector<statement_ptr_t>&);
+
+    void enter_identifier(Identifier&);
+    void enter_primitive_literal(PrimitiveLiteral&);
+    void enter_array_literal(ArrayLiteral&);
+    void enter_tuple_literal(TupleLiteral&);
+    void enter_range_literal(RangeLiteral&);
+    void enter_rgb_literal(RgbLiteral&);
+    void enter_hsv_literal(HsvLiteral&);
+    void enter_vector_literal(VectorLiteral&);
+    void enter_interpolated_string(InterpolatedString&);
+    void enter_parenthesized(Parenthesized&);
+    void enter_binary_op(BinaryOp&);
+    void enter_assignment_op(AssignmentOp&);
+    void enter_unary_op(UnaryOp&);
+    void enter_postfix_unary_op(PostfixUnaryOp&);
+    void enter_invocation(Invocation&);
+    void enter_member_access(MemberAccess&);
+    void enter_optional_member_access(OptionalMemberAccess&);
+    void enter_element_access(ElementAccess&);
+    void enter_await(Await&);
+    void enter_name_of(NameOf&);
+    void enter_type_of(TypeOf&);
+
+    void leave_expression_statement(ExpressionStatement&);
+    void enter_block(Block&);
+    void leave_block(Block&);
+    void enter_type_declaration(TypeDeclaration&);
+    void leave_type_declaration(TypeDeclaration&);
+    void enter_variable_declaration(VariableDeclaration&);
+    void leave_variable_declaration(VariableDeclaration&);
+    void enter_event_declaration(EventDeclaration&);
+    void leave_event_declaration(EventDeclaration&);
+    void enter_enum_declaration(EnumDeclaration&);
+    void leave_enum_declaration(EnumDeclaration&);
+    void enter_interface_declaration(InterfaceDeclaration&);
+    void leave_interface_declaration(InterfaceDeclaration&);
+    void enter_interface_field(InterfaceField&);
+    void enter_interface_method(InterfaceMethod&);
+    void enter_function_declaration(FunctionDeclaration&);
+    void leave_function_declaration(FunctionDeclaration&);
+    void enter_parameter(Parameter&);
+    void enter_instance_constructor(InstanceConstructor&);
+    void enter_instance_attribute_declarator(InstanceAttributeDeclarator&);
+    void enter_instance_name_declarator(InstanceNameDeclarator&);
+    void enter_instance_property_declarator(InstancePropertyDeclarator&);
+    void enter_instance_tag_declarator(InstanceTagDeclarator&);
+    void enter_break(Break&);
+    void enter_continue(Continue&);
+    void enter_return(Return&);
+    void enter_while(While&);
+    void leave_while(While&);
+    void enter_repeat(Repeat&);
+    void leave_repeat(Repeat&);
+    void enter_for(For&);
+    void leave_for(For&);
+    void enter_every(Every&);
+    void leave_every(Every&);
+    void enter_import(Import&);
+
+    void enter_type_name(TypeNameRef&);
+    void enter_type_parameter(TypeParameterRef&);
+    void leave_type_parameter(TypeParameterRef&);
+};
@@ -0,0 +1,22 @@
+#pragma once
+#include <string_view>
+
+/**
+ * Vectorized byte scanning used by the lexer to skip over long runs of uninteresting characters.
+ * Each function returns the position of the first character at or after `position` that ends the run, or `text.size()`.
+ * The implementation (AVX2, SSE2 or scalar) is picked once at runtime based on what the CPU supports.
+ */
+namespace scanning
+{
+    /** Finds the end of a run of non-newline whitespace */
+    size_t whitespace_end(std::string_view text, size_t position);
+    /** Finds the end of a run of identifier characters (including numbers) */
+    size_t identifier_end(std::string_view text, size_t position);
+    /** Finds the next line feed */
+    size_t line_end(std::string_view text, size_t position);
+    /** Finds the next character a string body has to look at: `terminator`, a line feed, or a possible interpolation boundary */
+    size_t string_body_end(std::string_view text, size_t position, char terminator);
+
+    /** Name of the implementation in use, for logging */
+    const char* implementation_name();
+}
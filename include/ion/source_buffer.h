@@ -0,0 +1,42 @@
+#pragma once
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+/**
+ * Read-only bytes of a source file, either owned in memory or memory-mapped from disk.
+ * The data never moves, so views of it stay valid for as long as the buffer does, even after it is moved.
+ */
+class SourceBuffer
+{
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+    std::unique_ptr<char[]> owned_;
+    bool mapped_ = false;
+
+    void release();
+
+public:
+    SourceBuffer() = default;
+    ~SourceBuffer();
+    SourceBuffer(SourceBuffer&&) noexcept;
+    SourceBuffer& operator=(SourceBuffer&&) noexcept;
+    SourceBuffer(const SourceBuffer&) = delete;
+    SourceBuffer& operator=(const SourceBuffer&) = delete;
+
+    /** Copies `text` into a buffer owned in memory */
+    static SourceBuffer from_string(std::string_view text);
+    /** Maps the file at `path` read-only, falling back to a single sized read if it can't be mapped */
+    static std::optional<SourceBuffer> from_file(const std::string& path);
+
+    [[nodiscard]] std::string_view view() const
+    {
+        return { data_, size_ };
+    }
+
+    [[nodiscard]] bool is_mapped() const
+    {
+        return mapped_;
+    }
+};
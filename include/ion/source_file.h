@@ -1,18 +1,49 @@
 #pragma once
 #include <string>
+#include <string_view>
 #include <vector>
 
+#include "ast_arena.h"
+#include "source_buffer.h"
+#include "string_arena.h"
+#include "diagnostics.h"
 #include "ast/node.h"
 
+/** Replacement of the characters in [`start`, `end`) of a file with `replacement` */
+struct SourceEdit
+{
+    size_t start;
+    size_t end;
+    std::string_view replacement;
+};
+
 struct SourceFile
 {
-    std::string path, text;
+    std::string path;
+    SourceBuffer buffer;
+    /** View of `buffer`'s contents */
+    std::string_view text;
+    /** Owns every node in `statements`, they're all released with the file */
+    AstArena ast_arena;
     std::vector<statement_ptr_t> statements;
+    /** Syntax errors the parser recovered from, `statements` has an `ErrorStatement` in place of each broken statement */
+    std::vector<DeferredError> syntax_errors;
+    /** Owns token text that can't be viewed directly from `text` (i.e. unescaped string literals) */
+    mutable StringArena string_arena;
+    /** Position of the first character of each line, used to look up lines and columns by binary search */
+    std::vector<int> line_starts;
 
-    SourceFile(std::string path, std::string text, std::vector<statement_ptr_t> statements = {})
+    SourceFile(std::string path, SourceBuffer buffer, std::vector<statement_ptr_t> statements = {})
         : path(std::move(path)),
-          text(std::move(text)),
+          buffer(std::move(buffer)),
+          text(this->buffer.view()),
           statements(std::move(statements))
+    {
+        index_lines();
+    }
+
+    SourceFile(std::string path, const std::string_view text, std::vector<statement_ptr_t> statements = {})
+        : SourceFile(std::move(path), SourceBuffer::from_string(text), std::move(statements))
     {
     }
 
@@ -21,6 +52,17 @@ struct SourceFile
     SourceFile& operator=(SourceFile&&) noexcept = default;
     SourceFile(const SourceFile&) = delete;
     SourceFile& operator=(const SourceFile&) = delete;
+
+    /** Returns the (1-based) number of the line containing `position` */
+    [[nodiscard]] int get_line_number(int position) const;
+    /** Returns the text of the (1-based) line `line`, without its line feed */
+    [[nodiscard]] std::string_view get_line_text(int line) const;
+    [[nodiscard]] FileLocation get_location(int position) const;
+    /** Applies `edit` to the text and re-indexes its lines, tokens and statements referring to the old text are left to the caller */
+    void apply(const SourceEdit& edit);
+
+private:
+    void index_lines();
 };
 
 SourceFile create_file(const std::string&);
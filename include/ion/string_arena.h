@@ -0,0 +1,34 @@
+#pragma once
+#include <memory>
+#include <string_view>
+#include <vector>
+
+/**
+ * Bump allocator for strings that have to outlive the lexer but don't exist verbatim in the source,
+ * e.g. unescaped string literals. Every view it hands out stays valid for as long as the arena does, even after it is moved.
+ */
+class StringArena
+{
+    static constexpr size_t chunk_size = 4096;
+
+    std::vector<std::unique_ptr<char[]>> chunks_;
+    size_t chunk_used_ = 0;
+    size_t chunk_capacity_ = 0;
+
+public:
+    StringArena() = default;
+    ~StringArena() = default;
+    StringArena(StringArena&&) noexcept = default;
+    StringArena& operator=(StringArena&&) noexcept = default;
+    StringArena(const StringArena&) = delete;
+    StringArena& operator=(const StringArena&) = delete;
+
+    /** Returns `size` bytes of uninitialized storage owned by the arena */
+    [[nodiscard]] char* allocate(size_t size);
+
+    /** Copies `text` into the arena and returns a view of the copy */
+    [[nodiscard]] std::string_view store(std::string_view text);
+
+    /** Takes ownership of all of `other`'s storage, views into it stay valid */
+    void absorb(StringArena&& other);
+};
@@ -8,15 +8,15 @@ struct DeclarationSymbol : NamedSymbol
 {
     const NamedDeclaration* declaration;
 
-    explicit DeclarationSymbol(std::string name, const NamedDeclaration* declaration, std::optional<type_ptr_t> type = std::nullopt)
-        : NamedSymbol(std::move(name), std::move(type)),
+    explicit DeclarationSymbol(const atom_t name, const NamedDeclaration* declaration, std::optional<type_ptr_t> type = std::nullopt)
+        : NamedSymbol(name, std::move(type)),
           declaration(declaration)
     {
     }
 
     [[nodiscard]] std::string to_string() const override
     {
-        return "DeclarationSymbol(" + name + (type.has_value() ? ", " + type.value()->to_string() : "") + ')' +
+        return "DeclarationSymbol(" + std::string(get_name()) + (type.has_value() ? ", " + type.value()->to_string() : "") + ')' +
                declaring_symbol_to_string();
     }
 
@@ -2,20 +2,26 @@
 #include <string>
 
 #include "symbol.h"
+#include "ion/atom_table.h"
 
 struct NamedSymbol : Symbol
 {
-    std::string name;
+    atom_t name;
 
-    explicit NamedSymbol(std::string name, std::optional<type_ptr_t> type = std::nullopt)
+    explicit NamedSymbol(const atom_t name, std::optional<type_ptr_t> type = std::nullopt)
         : Symbol(std::move(type)),
-          name(std::move(name))
+          name(name)
     {
     }
 
+    [[nodiscard]] std::string_view get_name() const
+    {
+        return get_spelling(name);
+    }
+
     [[nodiscard]] std::string to_string() const override
     {
-        return "NamedSymbol(" + name + (type.has_value() ? ", " + type.value()->to_string() : "") + ')' + declaring_symbol_to_string();
+        return "NamedSymbol(" + std::string(get_name()) + (type.has_value() ? ", " + type.value()->to_string() : "") + ')' + declaring_symbol_to_string();
     }
 
     [[nodiscard]] bool is_named_symbol() const override
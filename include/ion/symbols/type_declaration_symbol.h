@@ -9,15 +9,15 @@ struct TypeDeclarationSymbol final : DeclarationSymbol
 {
     type_ptr_t type;
 
-    explicit TypeDeclarationSymbol(std::string name, type_ptr_t type, const NamedDeclaration* declaration)
-        : DeclarationSymbol(std::move(name), declaration, std::move(type)),
+    explicit TypeDeclarationSymbol(const atom_t name, type_ptr_t type, const NamedDeclaration* declaration)
+        : DeclarationSymbol(name, declaration, std::move(type)),
           type(std::move(*Symbol::type))
     {
     }
 
     [[nodiscard]] std::string to_string() const override
     {
-        return "TypeDeclarationSymbol(" + name + ", " + type->to_string() + ')' + declaring_symbol_to_string();
+        return "TypeDeclarationSymbol(" + std::string(get_name()) + ", " + type->to_string() + ')' + declaring_symbol_to_string();
     }
 
     [[nodiscard]] bool is_type_declaration_symbol() const override
@@ -7,15 +7,15 @@ struct TypeSymbol final : NamedSymbol
 {
     type_ptr_t type;
 
-    explicit TypeSymbol(std::string name, type_ptr_t type)
-        : NamedSymbol(std::move(name), std::move(type)),
+    explicit TypeSymbol(const atom_t name, type_ptr_t type)
+        : NamedSymbol(name, std::move(type)),
           type(std::move(*Symbol::type))
     {
     }
 
     [[nodiscard]] std::string to_string() const override
     {
-        return "TypeSymbol(" + name + ", " + type->to_string() + ')' + declaring_symbol_to_string();
+        return "TypeSymbol(" + std::string(get_name()) + ", " + type->to_string() + ')' + declaring_symbol_to_string();
     }
 
     [[nodiscard]] bool is_type_symbol() const override
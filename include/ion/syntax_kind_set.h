@@ -0,0 +1,35 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <initializer_list>
+
+#include "token.h"
+
+/** Set of syntax kinds stored as one bit per kind, so it can be built at compile time and checked in constant time */
+class SyntaxKindSet
+{
+    static constexpr size_t word_bits = 64;
+
+    std::array<uint64_t, 256 / word_bits> words_ {};
+
+public:
+    constexpr SyntaxKindSet() = default;
+
+    constexpr SyntaxKindSet(const std::initializer_list<SyntaxKind> kinds)
+    {
+        for (const auto kind : kinds)
+            insert(kind);
+    }
+
+    constexpr void insert(const SyntaxKind kind)
+    {
+        const auto index = static_cast<unsigned char>(kind);
+        words_[index / word_bits] |= uint64_t { 1 } << index % word_bits;
+    }
+
+    [[nodiscard]] constexpr bool contains(const SyntaxKind kind) const
+    {
+        const auto index = static_cast<unsigned char>(kind);
+        return (words_[index / word_bits] >> index % word_bits & 1) != 0;
+    }
+};
@@ -0,0 +1,75 @@
+#pragma once
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/** Fixed set of worker threads running submitted tasks in the order they were submitted */
+class ThreadPool
+{
+    std::vector<std::thread> workers_;
+    std::queue<std::function<void ()>> tasks_;
+    std::mutex mutex_;
+    std::condition_variable task_available_;
+    bool stopping_ = false;
+
+    void work();
+
+public:
+    explicit ThreadPool(size_t thread_count = default_thread_count());
+    ~ThreadPool();
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /** Queues `task`, the returned future rethrows anything it throws */
+    template <typename F>
+    std::future<std::invoke_result_t<F>> submit(F&& task)
+    {
+        using result_t = std::invoke_result_t<F>;
+        auto packaged_task = std::make_shared<std::packaged_task<result_t ()>>(std::forward<F>(task));
+        auto future = packaged_task->get_future();
+        {
+            std::lock_guard lock(mutex_);
+            tasks_.emplace([packaged_task]
+            {
+                (*packaged_task)();
+            });
+        }
+
+        task_available_.notify_one();
+        return future;
+    }
+
+    /** Runs the oldest queued task on the calling thread, returns false if there was none */
+    bool try_run_task();
+
+    /**
+     * Waits for `future`, running queued tasks on the calling thread until the queue is empty. A task waiting on tasks it
+     * submitted therefore can't deadlock the pool (once the queue is empty they're all running), and a waiting main thread
+     * does work too.
+     */
+    template <typename T>
+    T wait(std::future<T>& future)
+    {
+        while (future.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+            if (!try_run_task())
+                break;
+
+        return future.get();
+    }
+
+    [[nodiscard]] size_t size() const
+    {
+        return workers_.size();
+    }
+
+    static size_t default_thread_count();
+    /** Pool shared by the whole compiler, created on first use */
+    static ThreadPool& shared();
+};
@@ -2,6 +2,7 @@
 #include <optional>
 #include <vector>
 
+#include "atom_table.h"
 #include "file_location.h"
 
 enum class SyntaxKind : unsigned char
@@ -109,11 +110,21 @@ enum class SyntaxKind : unsigned char
 struct Token
 {
     SyntaxKind kind {};
+    /** Interned spelling of identifiers assigned by the lexer, `no_atom` otherwise. Fits in the padding after `kind` */
+    atom_t atom = no_atom;
     FileSpan span;
-    std::optional<std::string> text;
+    /** View into either the source text or the file's string arena, the span's text is used if absent */
+    std::optional<std::string_view> text;
+    /** Value of number literals, decoded by the lexer */
+    std::optional<double> number_value {};
 
     [[nodiscard]] bool is_kind(SyntaxKind) const;
-    [[nodiscard]] std::string get_text() const;
+    [[nodiscard]] std::string_view get_text() const;
+    /** Returns the atom of the token's text, interning it if the token didn't come from the lexer */
+    [[nodiscard]] atom_t get_atom() const;
     [[nodiscard]] std::string format() const;
     [[nodiscard]] std::vector<Token> split(const std::vector<SyntaxKind>&) const;
-};
\ No newline at end of file
+};
+
+// AST nodes keep their tokens by value, so anything else known about a token belongs in `TokenTable`'s side tables
+static_assert(sizeof(Token) <= 96, "Token has grown");
\ No newline at end of file
@@ -0,0 +1,53 @@
+#pragma once
+#include <optional>
+#include <vector>
+
+#include "token.h"
+#include "token_table.h"
+#include "utility/lexer.h"
+
+/**
+ * Pull-based token source for the parser. Tokens are lexed on demand into a ring buffer that grows only as far as
+ * the parser looks ahead, so memory is proportional to lookahead depth instead of file size.
+ * Files big enough to be lexed in parallel chunks (see `lexing_chunk_count`) are lexed up front instead, and their
+ * `TokenTable` feeds the ring buffer.
+ * Tokens are addressed by their absolute index in the file.
+ */
+class TokenStream
+{
+    /** How many tokens behind the parser's position stay available, `previous_token()` and `fallback_span()` need a couple */
+    static constexpr int lookbehind = 4;
+    static constexpr size_t initial_capacity = 16;
+
+    LexState state_;
+    std::vector<Token> window_;
+    int first_ = 0;
+    int count_ = 0;
+    bool exhausted_ = false;
+    /** Every token of the file if it was lexed up front */
+    std::optional<TokenTable> pretokenized_;
+    token_index_t next_pretokenized_ = 0;
+
+    void pretokenize(const SourceFile& file, size_t chunk_count);
+    bool fill();
+    void push(const Token& token);
+
+public:
+    explicit TokenStream(const SourceFile& file);
+
+    /** Returns the token at `index`, lexing up to it if needed, or `nullptr` if the file ends before it */
+    [[nodiscard]] const Token* at(int index);
+    /** Lets the stream drop tokens that are more than a few tokens behind `index`, or behind the last lexed token */
+    void discard_before(int index);
+
+    /** How many tokens have been lexed so far */
+    [[nodiscard]] int lexed_count() const
+    {
+        return first_ + count_;
+    }
+
+    [[nodiscard]] size_t window_capacity() const
+    {
+        return window_.size();
+    }
+};
@@ -0,0 +1,98 @@
+#pragma once
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "token.h"
+
+using token_index_t = uint32_t;
+
+/**
+ * Compact token storage for a whole file: parallel arrays of kinds, 32-bit start offsets, 32-bit lengths and identifier atoms.
+ * Lines and columns aren't stored, they are recovered from the file's line index when a span is requested.
+ */
+class TokenTable
+{
+    /** Text of a token that isn't just the source text it spans */
+    struct TextOverride
+    {
+        bool in_arena;
+        /** Text owned by the file's string arena */
+        std::string_view arena_text;
+        /** Otherwise the text is a slice of the source, kept relative to the token's offset so that it survives edits */
+        uint32_t relative_offset;
+        uint32_t length;
+    };
+
+    const SourceFile* file_;
+    std::vector<SyntaxKind> kinds_;
+    std::vector<uint32_t> offsets_;
+    std::vector<uint32_t> lengths_;
+    /** Atoms of identifiers (`no_atom` for other tokens), dense since identifiers make up a large share of all tokens */
+    std::vector<atom_t> atoms_;
+    /** Text of tokens that isn't just the source text they span (i.e. unescaped strings), by token index */
+    std::unordered_map<token_index_t, TextOverride> text_overrides_;
+    /** Decoded values of number literals, by token index */
+    std::unordered_map<token_index_t, double> number_values_;
+
+public:
+    explicit TokenTable(const SourceFile& file);
+
+    void push(const Token& token);
+    /** Appends all of `other`'s tokens, which must come from the same file */
+    void append(const TokenTable& other);
+    /** Replaces the tokens in [`first`, `last`) with `replacement`'s and shifts the offsets of the tokens after them by `offset_delta` */
+    void splice(token_index_t first, token_index_t last, const TokenTable& replacement, int64_t offset_delta);
+    void reserve(size_t token_count);
+
+    [[nodiscard]] const SourceFile& get_file() const
+    {
+        return *file_;
+    }
+
+    [[nodiscard]] size_t size() const
+    {
+        return kinds_.size();
+    }
+
+    [[nodiscard]] bool empty() const
+    {
+        return kinds_.empty();
+    }
+
+    [[nodiscard]] SyntaxKind get_kind(const token_index_t index) const
+    {
+        return kinds_[index];
+    }
+
+    [[nodiscard]] uint32_t get_offset(const token_index_t index) const
+    {
+        return offsets_[index];
+    }
+
+    [[nodiscard]] uint32_t get_length(const token_index_t index) const
+    {
+        return lengths_[index];
+    }
+
+    [[nodiscard]] std::optional<atom_t> get_atom(const token_index_t index) const
+    {
+        return atoms_[index] != no_atom ? std::optional(atoms_[index]) : std::nullopt;
+    }
+
+    [[nodiscard]] const std::vector<SyntaxKind>& get_kinds() const
+    {
+        return kinds_;
+    }
+
+    /** Returns the index of the first token that ends at or after `position`, or the token count if there is none */
+    [[nodiscard]] token_index_t find_first_ending_at(size_t position) const;
+    [[nodiscard]] std::string_view get_text(token_index_t index) const;
+    [[nodiscard]] FileSpan get_span(token_index_t index) const;
+    /** Expands the token at `index` back into a full `Token` */
+    [[nodiscard]] Token get_token(token_index_t index) const;
+    /** Bytes used by the table's arrays, not counting the text overrides */
+    [[nodiscard]] size_t memory_usage() const;
+};
@@ -1,8 +1,8 @@
 #pragma once
-#include "ion/ast/visitor.h"
+#include "ion/ast/walker.h"
 #include "ion/logger.h"
 
-class TypeSolver final : public AstVisitor<void>
+class TypeSolver final : public AstWalker<TypeSolver>
 {
 public:
     TypeSolver()
@@ -12,15 +12,12 @@ public:
 
     static void bind_type(const SyntaxNode&, const type_ptr_t&);
 
-    void visit_primitive_literal(PrimitiveLiteral&) override;
-    void visit_array_literal(ArrayLiteral&) override;
-    void visit_range_literal(RangeLiteral&) override;
-    void visit_tuple_literal(TupleLiteral&) override;
-    void visit_rgb_literal(RgbLiteral&) override;
-    void visit_hsv_literal(HsvLiteral&) override;
-    void visit_vector_literal(VectorLiteral&) override;
-    void visit_identifier(Identifier&) override;
+    void leave_primitive_literal(PrimitiveLiteral&);
+    void leave_array_literal(ArrayLiteral&);
+    void leave_range_literal(RangeLiteral&);
+    void leave_tuple_literal(TupleLiteral&);
+    void leave_identifier(Identifier&);
 
-    void visit_expression_statement(ExpressionStatement&) override;
-    void visit_variable_declaration(VariableDeclaration&) override;
+    void leave_expression_statement(ExpressionStatement&);
+    void leave_variable_declaration(VariableDeclaration&);
 };
\ No newline at end of file
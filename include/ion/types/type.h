@@ -42,7 +42,7 @@ struct TypePtrEq
 struct Type
 {
     static type_ptr_t from_interface(const InterfaceDeclaration& declaration);
-    static type_ptr_t from(std::unique_ptr<TypeRef>&);
+    static type_ptr_t from(TypeRef*);
     static type_ptr_t lower(const type_ptr_t&);
     static bool is_list_same(const std::vector<type_ptr_t>& list, const std::vector<type_ptr_t>& other_list);
 
@@ -12,7 +12,7 @@
         std::vector<std::string> texts = {}; \
         texts.reserve(element_name##s.size()); \
         for (const auto& element_name : element_name##s) \
-            texts.push_back(string_eval()); \
+            texts.emplace_back(string_eval()); \
         return join_by(texts, separator); \
     }
 
@@ -45,9 +45,9 @@ inline void assert_assignment_target(const expression_ptr_t& expression)
 }
 
 DEFINE_JOIN_BY_METHOD(type, type->to_string, type_ptr_t);
-DEFINE_JOIN_BY_METHOD(expression, expression->get_text, expression_ptr_t);
-DEFINE_JOIN_BY_METHOD(statement, statement->get_text, statement_ptr_t);
-DEFINE_JOIN_BY_METHOD(type_ref, type_ref->get_text, type_ref_ptr_t);
+DEFINE_JOIN_BY_METHOD(expression, expression->reconstruct_text, expression_ptr_t);
+DEFINE_JOIN_BY_METHOD(statement, statement->reconstruct_text, statement_ptr_t);
+DEFINE_JOIN_BY_METHOD(type_ref, type_ref->reconstruct_text, type_ref_ptr_t);
 DEFINE_JOIN_BY_METHOD(token, token.get_text, Token);
 
 inline std::string generics_to_string(const std::vector<type_ptr_t>& type_parameters)
@@ -1,4 +1,9 @@
 #pragma once
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <optional>
 #include <variant>
 #include <ranges>
 #include <set>
@@ -21,30 +26,90 @@
 
 using primitive_value_t = std::variant<double, bool, std::string>;
 
-inline double to_number(const std::string& s)
+struct NumberUnit
 {
-    if (s.starts_with("0x") || s.starts_with("0X"))
-        return static_cast<double>(std::stoll(s, nullptr, 16));
-    if (s.starts_with("0o") || s.starts_with("0O"))
-        return static_cast<double>(std::stoll(s.substr(2), nullptr, 8));
-    if (s.starts_with("0b") || s.starts_with("0B"))
-        return static_cast<double>(std::stoll(s.substr(2), nullptr, 2));
-
-    auto number = std::stod(s);
-    if (s.ends_with("ms"))
-        number /= 1000;
-    else if (s.ends_with("m"))
-        number *= 60;
-    else if (s.ends_with("hz"))
-        number /= 60;
-    else if (s.ends_with("h"))
-        number *= 3600;
-    else if (s.ends_with("d"))
-        number *= 86400;
-    else if (s.ends_with("%"))
-        number /= 100;
-
-    return number;
+    std::string_view suffix;
+    double multiplier;
+    double divisor;
+};
+
+/** Unit suffixes a decimal number literal can have, longer suffixes first */
+constexpr std::array<NumberUnit, 7> number_units = { {
+    { "ms", 1, 1000 },
+    { "hz", 1, 60 },
+    { "s", 1, 1 },
+    { "m", 60, 1 },
+    { "h", 3600, 1 },
+    { "d", 86400, 1 },
+    { "%", 1, 100 }
+} };
+
+/**
+ * Decodes a number literal the way the lexer reads it: `0x`/`0o`/`0b` prefixes, `_` separators and the unit suffixes
+ * `s`, `ms`, `m`, `h`, `hz`, `d` and `%`. Returns `std::nullopt` if `text` isn't a complete, representable number.
+ */
+inline std::optional<double> decode_number(std::string_view text)
+{
+    auto base = 10;
+    if (text.size() >= 2 && text[0] == '0')
+    {
+        const auto specifier = text[1] | 0x20;
+        base = specifier == 'x' ? 16 : specifier == 'o' ? 8 : specifier == 'b' ? 2 : 10;
+        if (base != 10)
+            text.remove_prefix(2);
+    }
+
+    auto multiplier = 1.0;
+    auto divisor = 1.0;
+    if (base == 10)
+    {
+        for (const auto& unit : number_units)
+        {
+            if (!text.ends_with(unit.suffix))
+                continue;
+
+            multiplier = unit.multiplier;
+            divisor = unit.divisor;
+            text.remove_suffix(unit.suffix.size());
+            break;
+        }
+    }
+
+    // separators are copied out on the stack, from_chars can't skip them
+    std::array<char, 128> digits_buffer {};
+    if (text.find('_') != std::string_view::npos)
+    {
+        if (text.size() > digits_buffer.size())
+            return std::nullopt;
+
+        const auto digits_end = std::ranges::copy_if(text, digits_buffer.begin(), [](const char character)
+        {
+            return character != '_';
+        }).out;
+
+        text = std::string_view(digits_buffer.data(), digits_end - digits_buffer.begin());
+    }
+
+    const auto first = text.data();
+    const auto last = text.data() + text.size();
+    double number;
+    if (base == 10)
+    {
+        const auto [end, error] = std::from_chars(first, last, number);
+        if (error != std::errc {} || end != last || text.empty())
+            return std::nullopt;
+    }
+    else
+    {
+        uint64_t integer;
+        const auto [end, error] = std::from_chars(first, last, integer, base);
+        if (error != std::errc {} || end != last || text.empty())
+            return std::nullopt;
+
+        number = static_cast<double>(integer);
+    }
+
+    return number * multiplier / divisor;
 }
 
 inline std::string primitive_to_string(const std::optional<primitive_value_t>& value)
@@ -64,16 +129,16 @@ inline std::string primitive_to_string(const std::optional<primitive_value_t>& v
     }, *value);
 }
 
-inline primitive_value_t primitive_from_string(const std::string& text)
+inline primitive_value_t primitive_from_string(const std::string_view text)
 {
     if (text == "true")
         return true;
     if (text == "false")
         return false;
     if (text.starts_with('"') || text.starts_with('\''))
-        return text.substr(1, text.size() - 2);
+        return std::string(text.substr(1, text.size() - 2));
 
-    return to_number(text);
+    return decode_number(text).value_or(0);
 }
 
 namespace Color
@@ -1,6 +1,5 @@
 #pragma once
 #include <algorithm>
-#include <functional>
 
 #include "ion/diagnostics.h"
 #include "ion/token.h"
@@ -10,6 +9,8 @@ struct LexState : FileLocation
 {
     FileLocation lexeme_start;
     std::vector<Token> tokens;
+    /** Where unescaped string literals are stored, normally the file's own arena */
+    StringArena* string_arena;
 };
 
 /** Is at end of file? */
@@ -42,14 +43,16 @@ inline std::optional<char> advance(LexState& state, const int amount = 1)
     return current_character(state);
 }
 
-static bool ident(char)
+/** Advances to `position`, which has to be on the current line */
+inline void advance_to(LexState& state, const size_t position)
 {
-    return true;
+    advance(state, static_cast<int>(position) - state.position);
 }
 
-static void advance_while(LexState& state, const std::function<bool (char)>& predicate = ident)
+template <typename Predicate>
+void advance_while(LexState& state, Predicate&& predicate)
 {
-    while (!is_eof(state) && predicate(current_character(state)))
+    while (!is_eof(state) && predicate(peek(state, 0)))
         advance(state);
 }
 
@@ -68,21 +71,6 @@ inline bool check_any(LexState& state, const std::vector<char>& characters)
     });
 }
 
-/** Returns whether the next N characters are the same characters (in order) in `characters` */
-inline bool check_sequential(const LexState& state, const std::vector<char>& characters)
-{
-    auto match = true;
-    auto offset = 0;
-    for (const auto& character : characters)
-    {
-        match = match && check(state, character, offset++);
-        if (!match)
-            break;
-    }
-
-    return match;
-}
-
 /** Returns whether the current character is `character`, and advances if it is */
 inline bool match(LexState& state, const char character)
 {
@@ -103,17 +91,6 @@ inline bool match_any(LexState& state, const std::vector<char>& characters)
     return is_match;
 }
 
-/** Returns whether the next N characters are the same characters (in order) in `pattern`, and advances if they are */
-inline bool match_sequential(LexState& state, const std::string& pattern)
-{
-    const std::vector characters(pattern.begin(), pattern.end());
-    const auto is_match = check_sequential(state, characters);
-    if (is_match)
-        advance(state, static_cast<int>(characters.size()));
-
-    return is_match;
-}
-
 /** Creates a `FileLocation` from the current lexer position */
 inline FileLocation current_location(const LexState& state)
 {
@@ -127,10 +104,10 @@ inline FileSpan current_span(const LexState& state)
     return create_span(state.lexeme_start, current_location(state));
 }
 
-inline std::string current_lexeme(const LexState& state)
+inline std::string_view current_lexeme(const LexState& state)
 {
     const auto start_position = state.lexeme_start.position;
-    return state.file->text.substr(start_position, state.position - start_position);
+    return std::string_view(state.file->text).substr(start_position, state.position - start_position);
 }
 
 /** Reset `lexeme_start` back to the current location */
@@ -140,7 +117,7 @@ inline void start_new_lexeme(LexState& state)
 }
 
 /** Returns the current lexeme and starts a new one */
-inline std::string consume_lexeme(LexState& state)
+inline std::string_view consume_lexeme(LexState& state)
 {
     const auto lexeme = current_lexeme(state);
     start_new_lexeme(state);
@@ -155,7 +132,7 @@ inline std::string consume_lexeme(LexState& state)
 struct LexemeGuard
 {
     LexState& state;
-    std::string result;
+    std::string_view result;
     bool consumed = false;
 
     ~LexemeGuard()
@@ -163,7 +140,7 @@ struct LexemeGuard
         consume();
     }
 
-    std::string release()
+    std::string_view release()
     {
         consume();
         return result;
@@ -182,20 +159,41 @@ private:
 
 [[noreturn]] inline void malformed_number(const LexState& state)
 {
-    report_malformed_number(current_span(state), current_lexeme(state));
+    report_malformed_number(current_span(state), std::string(current_lexeme(state)));
 }
 
-/** Push a token with custom text not from the file */
-inline void push_token_override_text(LexState& state, const SyntaxKind kind, const std::string& text)
+/** Push a token with custom text, which must either be a view of the file's text or be owned by its string arena */
+inline void push_token_override_text(LexState& state, const SyntaxKind kind, const std::string_view text)
 {
-    const auto token = Token { kind, current_span(state), text };
+    const auto token = Token { .kind = kind, .span = current_span(state), .text = text };
+    start_new_lexeme(state);
+    state.tokens.push_back(token);
+}
+
+/** Push a number literal token along with its decoded value */
+inline void push_number_token(LexState& state, const double value)
+{
+    const auto token = Token {
+        .kind = SyntaxKind::NumberLiteral,
+        .span = current_span(state),
+        .text = current_lexeme(state),
+        .number_value = value
+    };
+
     start_new_lexeme(state);
     state.tokens.push_back(token);
 }
 
 inline void push_token(LexState& state, const SyntaxKind kind)
 {
-    const auto token = Token { kind, current_span(state) };
+    push_token_override_text(state, kind, current_lexeme(state));
+}
+
+/** Push an identifier token along with its interned spelling */
+inline void push_identifier_token(LexState& state)
+{
+    const auto lexeme = current_lexeme(state);
+    const auto token = Token { .kind = SyntaxKind::Identifier, .atom = intern(lexeme), .span = current_span(state), .text = lexeme };
     start_new_lexeme(state);
     state.tokens.push_back(token);
 }
@@ -241,62 +239,68 @@ inline bool is_binary_digit(const LexState& state)
     return character == '1' || character == '0';
 }
 
-inline std::string unescape(const std::string& s)
+/**
+ * Resolves escape sequences in `s`. Strings without any escapes are returned as-is (still viewing the source),
+ * otherwise the unescaped copy is written into `arena`.
+ */
+inline std::string_view unescape(const std::string_view s, StringArena& arena)
 {
-    std::string result;
-    result.reserve(s.size());
+    if (s.find('\\') == std::string_view::npos)
+        return s;
 
+    const auto result = arena.allocate(s.size());
+    size_t length = 0;
     for (size_t i = 0; i < s.size(); ++i)
     {
         if (s[i] != '\\' || i + 1 >= s.size())
         {
-            result += s[i];
+            result[length++] = s[i];
             continue;
         }
 
         switch (s[++i])
         {
             case 'n':
-                result += '\n';
+                result[length++] = '\n';
                 break;
             case 'r':
-                result += '\r';
+                result[length++] = '\r';
                 break;
             case 't':
-                result += '\t';
+                result[length++] = '\t';
                 break;
             case 'b':
-                result += '\b';
+                result[length++] = '\b';
                 break;
             case 'f':
-                result += '\f';
+                result[length++] = '\f';
                 break;
             case 'v':
-                result += '\v';
+                result[length++] = '\v';
                 break;
             case 'a':
-                result += '\a';
+                result[length++] = '\a';
                 break;
             case 'e':
-                result += '\x1B';
+                result[length++] = '\x1B';
                 break; // escape
             case '\\':
-                result += '\\';
+                result[length++] = '\\';
                 break;
             case '#':
-                result += '#';
+                result[length++] = '#';
                 break;
             case '"':
-                result += '"';
+                result[length++] = '"';
                 break;
             case '\'':
-                result += '\'';
+                result[length++] = '\'';
                 break;
             default:
-                result += s[i];
+                result[length++] = s[i];
                 break; // unknown escape: keep literal
         }
     }
 
-    return result;
+    return { result, length };
 }
\ No newline at end of file
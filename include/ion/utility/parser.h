@@ -1,108 +1,129 @@
 #pragma once
+#include <type_traits>
+
+#include "ion/ast_arena.h"
+#include "ion/large_stack.h"
 #include "ion/lexer.h"
+#include "ion/syntax_kind_set.h"
+#include "ion/token_stream.h"
 
 struct ParseState
 {
-    int position = 0,
-        stack_position = 0;
-
-    const SourceFile* file;
-    std::vector<Token> token_stream, token_stack;
+    int position = 0;
+
+    const SourceFile* file = nullptr;
+    /** Mutable because peeking ahead may have to lex more of the file */
+    mutable TokenStream token_stream;
+    /** Stands in for the token at `overlay_index`, used for what's left of a `>>` or `>>>` after splitting off one `>` */
+    Token overlay {};
+    int overlay_index = -1;
+    /** How many `{` have been consumed without their `}`, recovery uses it to skip to the end of a broken statement */
+    int brace_depth = 0;
+    /** Syntax errors recovered from so far, in the order they were found */
+    std::vector<DeferredError> errors {};
+    /** Set once the parser has tried to advance past the last token */
+    bool reached_eof = false;
+    /** Set once a syntax error has been recorded after `reached_eof`, every later one would be reported at the same EOF */
+    bool reported_eof = false;
+    /** How many levels of nesting `parse_nested` is currently in */
+    int nesting_depth = 0;
+    /** Set once `max_nesting_depth` is exceeded, the file isn't parsed any further */
+    bool nested_too_deep = false;
 };
 
-inline bool is_eof(const ParseState& state, const int offset = 0)
+/**
+ * The most stack one level of nesting may take. GCC builds measured up to about 5KB per level (a parenthesized
+ * expression inside a `nameof` being the deepest path), the rest is headroom for other compilers and build types.
+ */
+constexpr size_t nesting_level_stack_size = 16 * 1024;
+/** How much of the calling thread's stack the parser may use, threads get as little as 512KB on some platforms */
+constexpr size_t inline_parse_stack_size = 256 * 1024;
+/** Stack of the thread that parsing continues on once it nests deeper than fits on the calling thread's */
+constexpr size_t large_parse_stack_size = 64 * 1024 * 1024;
+
+/** Nesting levels parsed on the calling thread, deeper ones are parsed on a thread with a `large_parse_stack_size` stack */
+constexpr int max_inline_nesting_depth = static_cast<int>(inline_parse_stack_size / nesting_level_stack_size);
+/** How deeply constructs may nest, one level more is reported as a syntax error instead of overflowing the stack */
+constexpr int max_nesting_depth = max_inline_nesting_depth + static_cast<int>(large_parse_stack_size / nesting_level_stack_size);
+
+/** Returns the token at an absolute index, or nullptr past the end of the file. Lexing more of the file invalidates it */
+inline const Token* token_at(const ParseState& state, const int index)
 {
-    const auto stream_size = static_cast<int>(state.token_stream.size());
-    const auto offset_position = state.position + offset;
-    return offset_position < 0 || offset_position >= stream_size;
+    if (index == state.overlay_index)
+        return &state.overlay;
+
+    return state.token_stream.at(index);
 }
 
-inline std::optional<Token> maybe_peek(const ParseState& state, const int offset)
+inline bool is_eof(const ParseState& state, const int offset = 0)
 {
-    if (is_eof(state, offset))
-        return std::nullopt;
+    return token_at(state, state.position + offset) == nullptr;
+}
 
-    return state.token_stream.at(state.position + offset);
+inline const Token* maybe_peek(const ParseState& state, const int offset)
+{
+    return token_at(state, state.position + offset);
 }
 
-inline Token peek(const ParseState& state, const int offset)
+inline const Token& peek(const ParseState& state, const int offset)
 {
-    COMPILER_ASSERT(!is_eof(state, offset), "Parser attempted to access an out of bounds token index");
-    return *maybe_peek(state, offset);
+    const auto token = maybe_peek(state, offset);
+    COMPILER_ASSERT(token != nullptr, "Parser attempted to access an out of bounds token index");
+    return *token;
 }
 
-inline Token current_token_guaranteed(const ParseState& state)
+inline const Token& current_token_guaranteed(const ParseState& state)
 {
     return peek(state, 0);
 }
 
-inline std::optional<Token> current_token(const ParseState& state)
+inline const Token* current_token(const ParseState& state)
 {
     return maybe_peek(state, 0);
 }
 
-inline Token previous_token_guaranteed(const ParseState& state)
+inline const Token& previous_token_guaranteed(const ParseState& state)
 {
     return peek(state, -1);
 }
 
-inline std::optional<Token> previous_token(const ParseState& state)
+inline const Token* previous_token(const ParseState& state)
 {
     return maybe_peek(state, -1);
 }
 
-inline int position_with_default(const ParseState& state, const int position)
-{
-    return position == -1 ? state.stack_position : position;
-}
-
-inline bool stack_token_exists(const ParseState& state, const int position = -1)
+/** Returns the current token before incrementing the position, at EOF the position stays put and nullptr is returned */
+inline const Token* advance(ParseState& state)
 {
-    return !state.token_stack.empty() && position_with_default(state, position) < state.token_stack.size();
-}
-
-inline Token stack_token_at(const ParseState& state, const int position = -1)
-{
-    COMPILER_ASSERT(stack_token_exists(state, position),
-                    "Stack position out of bounds indexing current stack token: " + std::to_string(position));
-
-    return state.token_stack.at(position_with_default(state, position));
-}
+    const auto token = current_token(state);
+    if (token == nullptr)
+    {
+        state.reached_eof = true;
+        return nullptr;
+    }
 
-/** Returns the current token before incrementing the position */
-inline std::optional<Token> advance(ParseState& state)
-{
-    if (stack_token_exists(state))
-        return stack_token_at(state, state.stack_position++);
+    if (state.position == state.overlay_index)
+        state.overlay_index = -1;
 
-    const auto token = current_token(state);
-    state.stack_position = 0;
-    state.token_stack = {};
-    state.position++;
+    if (token->is_kind(SyntaxKind::LBrace))
+        state.brace_depth++;
+    else if (token->is_kind(SyntaxKind::RBrace))
+        state.brace_depth--;
 
+    state.token_stream.discard_before(++state.position);
     return token;
 }
 
-inline bool check_stack(const ParseState& state, const SyntaxKind kind)
-{
-    return stack_token_exists(state) && stack_token_at(state).is_kind(kind);
-}
-
 inline bool check(const ParseState& state, const SyntaxKind kind, const int offset = 0)
 {
-    const auto token_opt = maybe_peek(state, offset);
-    if (!token_opt.has_value())
-        return false;
-
-    return token_opt.value().is_kind(kind);
+    const auto token = maybe_peek(state, offset);
+    return token != nullptr && token->is_kind(kind);
 }
 
-inline bool check_any(const ParseState& state, const std::set<SyntaxKind>& syntaxes, const int offset = 0)
+inline bool check_any(const ParseState& state, const SyntaxKindSet& syntaxes, const int offset = 0)
 {
-    return !is_eof(state) && std::ranges::any_of(syntaxes, [&](const auto syntax)
-    {
-        return check(state, syntax, offset);
-    });
+    const auto token = maybe_peek(state, offset);
+    return token != nullptr && syntaxes.contains(token->kind);
 }
 
 inline bool match(ParseState& state, const SyntaxKind kind)
@@ -114,7 +135,7 @@ inline bool match(ParseState& state, const SyntaxKind kind)
     return is_match;
 }
 
-inline bool match_any(ParseState& state, const std::set<SyntaxKind>& syntaxes)
+inline bool match_any(ParseState& state, const SyntaxKindSet& syntaxes)
 {
     const auto is_match = check_any(state, syntaxes);
     if (is_match)
@@ -123,6 +144,15 @@ inline bool match_any(ParseState& state, const std::set<SyntaxKind>& syntaxes)
     return is_match;
 }
 
+/** Number literals use the value the lexer decoded, everything else is parsed from its text */
+inline primitive_value_t primitive_from_token(const Token& token)
+{
+    if (token.number_value.has_value())
+        return *token.number_value;
+
+    return primitive_from_string(token.get_text());
+}
+
 inline FileSpan empty_span(const ParseState& state)
 {
     return create_span(get_start_location(*state.file), get_start_location(*state.file));
@@ -139,8 +169,8 @@ inline FileSpan empty_span(const ParseState& state)
  */
 inline FileSpan fallback_span(const ParseState& state, const int offset = 0)
 {
-    if (const auto token = maybe_peek(state, offset); token.has_value())
-        return token.value().span;
+    if (const auto token = maybe_peek(state, offset); token != nullptr)
+        return token->span;
 
     if (state.position + offset < 0)
         return empty_span(state);
@@ -150,10 +180,59 @@ inline FileSpan fallback_span(const ParseState& state, const int offset = 0)
                : fallback_span(state, offset - 1);
 }
 
+/** Counts one level of nesting while alive, reports a syntax error instead once `max_nesting_depth` levels are open */
+struct NestingGuard
+{
+    ParseState& state;
+
+    explicit NestingGuard(ParseState& state)
+        : state(state)
+    {
+        if (++state.nesting_depth <= max_nesting_depth)
+            return;
+
+        state.nesting_depth--;
+        state.nested_too_deep = true;
+        report_nesting_too_deep(fallback_span(state));
+    }
+
+    ~NestingGuard()
+    {
+        state.nesting_depth--;
+    }
+
+    NestingGuard(const NestingGuard&) = delete;
+    NestingGuard& operator=(const NestingGuard&) = delete;
+};
+
+/**
+ * Parses something nested one level deeper than what contains it: a block, a statement that's the body of another one
+ * without being a block, an expression or a type. The level that no longer fits on the calling thread's stack moves
+ * to a thread with a larger one, along with the AST arena and the error deferral the parser runs with.
+ */
+template <typename Parse>
+std::invoke_result_t<Parse> parse_nested(ParseState& state, Parse&& parse)
+{
+    NestingGuard guard(state);
+    if (state.nesting_depth != max_inline_nesting_depth)
+        return parse();
+
+    std::invoke_result_t<Parse> result;
+    auto& arena = AstArena::current();
+    run_with_stack_size(large_parse_stack_size, [&]
+    {
+        AstArenaScope arena_scope(arena);
+        ErrorDeferral deferral;
+        result = parse();
+    });
+
+    return result;
+}
+
 inline std::optional<Token> try_consume(ParseState& state, const SyntaxKind kind)
 {
     if (match(state, kind))
-        return previous_token(state);
+        return previous_token_guaranteed(state);
 
     return std::nullopt;
 }
@@ -166,7 +245,7 @@ inline Token expect(ParseState& state,
     const auto span = fallback_span(state);
     const auto token = advance(state);
 
-    if (token.has_value() && token.value().is_kind(kind))
+    if (token != nullptr && token->is_kind(kind))
         return *token;
 
     const auto is_identifier = kind == SyntaxKind::Identifier;
@@ -177,35 +256,33 @@ inline Token expect(ParseState& state,
                                     ? "identifier"
                                     : syntax_to_string(kind).value_or(std::to_string(static_cast<int>(kind)));
 
-    const auto got = token.has_value() ? token->get_text() : "EOF";
-    report_expected_different_syntax(span, expected, got, quote_expected);
+    const auto got = token != nullptr ? token->get_text() : "EOF";
+    report_expected_different_syntax(span, expected, std::string(got), quote_expected);
 }
 
+/**
+ * Expects a single `>`, splitting it off the front of a `>>` or `>>>` when nested type arguments close together.
+ * What's left of the split token is put in the overlay at the current position instead of advancing past it.
+ */
 inline Token expect_r_arrow(ParseState& state)
 {
-    if (check(state, SyntaxKind::RArrow) || check_stack(state, SyntaxKind::RArrow))
+    const auto token = current_token(state);
+    if (token == nullptr || !(token->is_kind(SyntaxKind::RArrowRArrow) || token->is_kind(SyntaxKind::RArrowRArrowRArrow)))
         return expect(state, SyntaxKind::RArrow);
 
-    if (check(state, SyntaxKind::RArrowRArrow) || check_stack(state, SyntaxKind::RArrowRArrow))
-    {
-        const auto base = expect(state, SyntaxKind::RArrowRArrow);
-        const auto arrows = base.split({ 2, SyntaxKind::RArrow });
-
-        state.token_stack.push_back(arrows.back());
-        return arrows.front();
-    }
-
-    if (check(state, SyntaxKind::RArrowRArrowRArrow))
-    {
-        const auto base = expect(state, SyntaxKind::RArrowRArrowRArrow);
-        const auto arrows = base.split({ 3, SyntaxKind::RArrow });
-        const auto& second_last = arrows.at(1);
-        const auto& last = arrows.at(2);
-        const auto new_span = create_span(second_last.span.start, last.span.end);
-
-        state.token_stack.emplace_back(SyntaxKind::RArrowRArrow, new_span, ">>");
-        return arrows.front();
-    }
-
-    return expect(state, SyntaxKind::RArrow);
-}
\ No newline at end of file
+    const auto text = token->get_text();
+    const auto span = token->span;
+    const auto rest_kind = token->is_kind(SyntaxKind::RArrowRArrowRArrow) ? SyntaxKind::RArrowRArrow : SyntaxKind::RArrow;
+    // both halves are copies of the split token, so neither leaves out any of its fields
+    auto r_arrow = *token;
+    r_arrow.kind = SyntaxKind::RArrow;
+    r_arrow.span = create_span(span.start, span.start + 1);
+    r_arrow.text = text.substr(0, 1);
+
+    state.overlay = *token;
+    state.overlay.kind = rest_kind;
+    state.overlay.span = create_span(span.start + 1, span.end);
+    state.overlay.text = text.substr(1);
+    state.overlay_index = state.position;
+    return r_arrow;
+}
@@ -1,19 +1,40 @@
 #include "ion/diagnostics.h"
 #include "ion/ast/node.h"
+#include "ion/source_file.h"
 
-Token SyntaxNode::get_last_token() const
+const Token& SyntaxNode::find_last_token() const
 {
-    return get_first_token();
+    return find_first_token();
+}
+
+const Token& SyntaxNode::get_first_token() const
+{
+    return first_token_ != nullptr ? *first_token_ : find_first_token();
+}
+
+const Token& SyntaxNode::get_last_token() const
+{
+    return last_token_ != nullptr ? *last_token_ : find_last_token();
 }
 
 FileSpan SyntaxNode::get_span() const
 {
-    const auto first = get_first_token();
-    const auto last = get_last_token();
-    if (first.span == last.span)
-        return first.span;
+    return create_span(get_first_token().span.start, get_last_token().span.end);
+}
+
+std::string_view SyntaxNode::get_text() const
+{
+    const auto span = get_span();
+    if (span.start.file == nullptr)
+        return {};
 
-    return create_span(first.span.start, last.span.end);
+    return span.start.file->text.substr(span.start.position, span.end.position - span.start.position);
+}
+
+void SyntaxNode::cache_span()
+{
+    first_token_ = &find_first_token();
+    last_token_ = &find_last_token();
 }
 
 symbol_ptr_t SyntaxNode::get_symbol()
@@ -2,9 +2,9 @@
 
 #include "ion/ast/viewer.h"
 
-void AstViewer::write(const std::string& text)
+void AstViewer::write(const std::string_view text)
 {
-    write(text.c_str());
+    std::cout << text;
 }
 
 void AstViewer::write(const char* text)
@@ -34,11 +34,35 @@ void AstViewer::write_line(const char* text) const
     write_indent();
 }
 
+void AstViewer::visit(const expression_ptr_t& expression)
+{
+    if (indent_ >= max_view_indent)
+        return write("...");
+
+    AstVisitor::visit(expression);
+}
+
+void AstViewer::visit(const statement_ptr_t& statement)
+{
+    if (indent_ >= max_view_indent)
+        return write("...");
+
+    AstVisitor::visit(statement);
+}
+
+void AstViewer::visit(const type_ref_ptr_t& type_ref)
+{
+    if (indent_ >= max_view_indent)
+        return write("...");
+
+    AstVisitor::visit(type_ref);
+}
+
 void AstViewer::write_binary_op_contents(const BinaryOp& binary_op)
 {
     visit(binary_op.left);
     write_line(",");
-    write_line('"' + binary_op.operator_token.get_text() + "\",");
+    write_line('"' + std::string(binary_op.operator_token.get_text()) + "\",");
     visit(binary_op.right);
 }
 
@@ -96,7 +120,7 @@ void AstViewer::visit_primitive_literal(PrimitiveLiteral& literal)
     else
     {
         const auto literal_value = literal.value.value();
-        write(literal.get_text());
+        write(literal.reconstruct_text());
     }
     write(")");
 }
@@ -174,7 +198,7 @@ void AstViewer::visit_interpolated_string(InterpolatedString& interpolated_strin
     write_list<Token>(interpolated_string.parts, [&](const auto& token)
     {
         const auto text = token.get_text();
-        write(text.empty() ? "(empty)" : '"' + text + '"');
+        write(text.empty() ? "(empty)" : '"' + std::string(text) + '"');
     });
     write_line(",");
     write_list<expression_ptr_t>(interpolated_string.interpolations, [&](const auto& expression)
@@ -211,7 +235,7 @@ void AstViewer::visit_unary_op(UnaryOp& unary_op)
 {
     indent_++;
     write_line("UnaryOp(");
-    write_line('"' + unary_op.operator_token.get_text() + "\",");
+    write_line('"' + std::string(unary_op.operator_token.get_text()) + "\",");
     visit(unary_op.operand);
     write_closing_paren();
 }
@@ -222,7 +246,7 @@ void AstViewer::visit_postfix_unary_op(PostfixUnaryOp& postfix_unary_op)
     write_line("PostfixUnaryOp(");
     visit(postfix_unary_op.operand);
     write_line(",");
-    write('"' + postfix_unary_op.operator_token.get_text() + '"');
+    write('"' + std::string(postfix_unary_op.operator_token.get_text()) + '"');
     write_closing_paren();
 }
 
@@ -384,7 +408,7 @@ void AstViewer::visit_interface_declaration(InterfaceDeclaration& interface_decl
 {
     indent_++;
     write_line("InterfaceDeclaration(");
-    write_line(interface_declaration.name.get_text() + ',');
+    write_line(std::string(interface_declaration.name.get_text()) + ',');
     write_list<statement_ptr_t>(interface_declaration.members->statements, [&](const auto& member)
     {
         visit(member);
@@ -396,7 +420,7 @@ void AstViewer::visit_interface_field(InterfaceField& interface_field)
 {
     indent_++;
     write_line("InterfaceField(");
-    write_line(interface_field.name.get_text() + ',');
+    write_line(std::string(interface_field.name.get_text()) + ',');
     visit(interface_field.type);
     write_line(",");
     write("Const: ");
@@ -424,7 +448,7 @@ void AstViewer::visit_enum_declaration(EnumDeclaration& enum_declaration)
 {
     indent_++;
     write_line("EnumDeclaration(");
-    write_line(enum_declaration.name.get_text() + ',');
+    write_line(std::string(enum_declaration.name.get_text()) + ',');
     write_list<statement_ptr_t>(enum_declaration.members->statements, [&](const auto& member)
     {
         visit(member);
@@ -515,7 +539,7 @@ void AstViewer::visit_instance_constructor(InstanceConstructor& instance_constru
 {
     indent_++;
     write_line("InstanceConstructor(");
-    write_line(instance_constructor.name.get_text() + ',');
+    write_line(std::string(instance_constructor.name.get_text()) + ',');
     visit(instance_constructor.colon_type->type);
     if (instance_constructor.clone_target.has_value())
     {
@@ -545,7 +569,7 @@ void AstViewer::visit_instance_property_declarator(InstancePropertyDeclarator& i
 {
     indent_++;
     write_line("InstancePropertyDeclarator(");
-    write_line(instance_property_declarator.name.get_text() + ',');
+    write_line(std::string(instance_property_declarator.name.get_text()) + ',');
     visit(instance_property_declarator.value);
     write_closing_paren();
 }
@@ -561,7 +585,7 @@ void AstViewer::visit_instance_attribute_declarator(InstanceAttributeDeclarator&
 {
     indent_++;
     write_line("InstanceAttributeDeclarator(");
-    write(instance_attribute_declarator.name.get_text() + ',');
+    write(std::string(instance_attribute_declarator.name.get_text()) + ',');
     visit(instance_attribute_declarator.value);
     write_closing_paren();
 }
@@ -702,7 +726,7 @@ void AstViewer::visit_match_else_case(MatchElseCase& match_else_case)
     indent_++;
     write_line("MatchElseCase(");
     if (match_else_case.name.has_value())
-        write_line(match_else_case.name->get_text() + ',');
+        write_line(std::string(match_else_case.name->get_text()) + ',');
 
     visit(match_else_case.statement);
     write_closing_paren();
@@ -733,7 +757,7 @@ void AstViewer::visit_decorator(Decorator& decorator)
 {
     indent_++;
     write_line("Decorator(");
-    write_line(decorator.name.get_text() + ',');
+    write_line(std::string(decorator.name.get_text()) + ',');
     write_list<expression_ptr_t>(decorator.arguments, [&](const auto& argument)
     {
         visit(argument);
@@ -741,6 +765,11 @@ void AstViewer::visit_decorator(Decorator& decorator)
     write_closing_paren();
 }
 
+void AstViewer::visit_error_statement(ErrorStatement& error_statement)
+{
+    write("ErrorStatement(" + error_statement.reconstruct_text() + ")");
+}
+
 void AstViewer::visit_primitive_type(PrimitiveTypeRef& primitive_type)
 {
     write("PrimitiveTypeRef(");
@@ -0,0 +1,92 @@
+#include <algorithm>
+
+#include "ion/ast_arena.h"
+#include "ion/diagnostics.h"
+
+static thread_local AstArena* current_arena = nullptr;
+
+void* AstArena::allocate(const size_t size, const size_t alignment)
+{
+    auto offset = (chunk_used_ + alignment - 1) & ~(alignment - 1);
+    if (chunks_.empty() || offset + size > chunk_capacity_)
+    {
+        chunk_capacity_ = std::max(chunk_size, size);
+        chunks_.push_back(std::make_unique<std::byte[]>(chunk_capacity_));
+        reserved_bytes_ += chunk_capacity_;
+        offset = 0;
+    }
+
+    chunk_used_ = offset + size;
+    return chunks_.back().get() + offset;
+}
+
+void AstArena::release()
+{
+    for (auto finalizer = last_finalizer_; finalizer != nullptr; finalizer = finalizer->previous)
+        finalizer->destroy(finalizer->object);
+
+    chunks_.clear();
+    chunk_used_ = 0;
+    chunk_capacity_ = 0;
+    last_finalizer_ = nullptr;
+    object_count_ = 0;
+    reserved_bytes_ = 0;
+}
+
+AstArena::~AstArena()
+{
+    release();
+}
+
+AstArena::AstArena(AstArena&& other) noexcept
+    : chunks_(std::move(other.chunks_)),
+      chunk_used_(std::exchange(other.chunk_used_, 0)),
+      chunk_capacity_(std::exchange(other.chunk_capacity_, 0)),
+      last_finalizer_(std::exchange(other.last_finalizer_, nullptr)),
+      object_count_(std::exchange(other.object_count_, 0)),
+      reserved_bytes_(std::exchange(other.reserved_bytes_, 0))
+{
+    other.chunks_.clear();
+}
+
+AstArena& AstArena::operator=(AstArena&& other) noexcept
+{
+    if (this == &other)
+        return *this;
+
+    release();
+    chunks_ = std::move(other.chunks_);
+    chunk_used_ = std::exchange(other.chunk_used_, 0);
+    chunk_capacity_ = std::exchange(other.chunk_capacity_, 0);
+    last_finalizer_ = std::exchange(other.last_finalizer_, nullptr);
+    object_count_ = std::exchange(other.object_count_, 0);
+    reserved_bytes_ = std::exchange(other.reserved_bytes_, 0);
+    other.chunks_.clear();
+    return *this;
+}
+
+size_t AstArena::object_count() const
+{
+    return object_count_;
+}
+
+size_t AstArena::memory_usage() const
+{
+    return reserved_bytes_;
+}
+
+AstArena& AstArena::current()
+{
+    COMPILER_ASSERT(current_arena != nullptr, "No AST arena to create nodes in");
+    return *current_arena;
+}
+
+AstArenaScope::AstArenaScope(AstArena& arena)
+    : previous_(std::exchange(current_arena, &arena))
+{
+}
+
+AstArenaScope::~AstArenaScope()
+{
+    current_arena = previous_;
+}
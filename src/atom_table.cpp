@@ -0,0 +1,43 @@
+#include <mutex>
+
+#include "ion/atom_table.h"
+#include "ion/diagnostics.h"
+
+atom_t AtomTable::intern(const std::string_view spelling)
+{
+    {
+        std::shared_lock lock(mutex_);
+        if (const auto it = atoms_.find(spelling); it != atoms_.end())
+            return it->second;
+    }
+
+    std::unique_lock lock(mutex_);
+    // another thread may have interned it in between the locks
+    if (const auto it = atoms_.find(spelling); it != atoms_.end())
+        return it->second;
+
+    const auto atom = static_cast<atom_t>(spellings_.size());
+    const auto stored_spelling = spellings_arena_.store(spelling);
+    spellings_.push_back(stored_spelling);
+    atoms_.emplace(stored_spelling, atom);
+    return atom;
+}
+
+std::string_view AtomTable::get_spelling(const atom_t atom) const
+{
+    std::shared_lock lock(mutex_);
+    COMPILER_ASSERT(atom < spellings_.size(), "Unknown atom " + std::to_string(atom));
+    return spellings_[atom];
+}
+
+size_t AtomTable::size() const
+{
+    std::shared_lock lock(mutex_);
+    return spellings_.size();
+}
+
+AtomTable& AtomTable::global()
+{
+    static AtomTable table;
+    return table;
+}
@@ -1,45 +1,127 @@
-#include <iostream>
+#include <algorithm>
+#include <future>
+#include <iterator>
 
 #include "ion/compiler.h"
 #include "ion/parsing/parser.h"
-#include "ion/binder.h"
 #include "ion/resolver.h"
 #include "ion/type_solver.h"
 #include "ion/ast/viewer.h"
+#include "ion/thread_pool.h"
 
 void Compiler::emit()
 {
+    // every file is parsed before any error is reported, so one run shows all of a project's syntax errors
+    run_phase(parse_file);
+    std::vector<DeferredError> syntax_errors;
     for (auto& file : files)
-        pre_emit(file);
+        std::ranges::move(file.syntax_errors, std::back_inserter(syntax_errors));
+
+    if (!syntax_errors.empty())
+        report_deferred_errors(syntax_errors);
+
+    // the viewer writes lines in pieces, so files are viewed one at a time
+    if (view_ast)
+        for (auto& file : files)
+            view(file);
+
+    run_phase(pre_emit);
+    for (const auto& file : files)
+        write_symbols(file);
+
+    run_phase(emit);
+}
+
+/**
+ * Runs `phase` over every file on the shared thread pool and waits for all of them, so that the next phase can rely on
+ * every file having finished this one. If any fail, the error of the first file in order is reported.
+ */
+void Compiler::run_phase(void (*phase)(SourceFile&))
+{
+    // with one file or one core there's nothing to run side by side, and starting the pool's threads would only cost
+    // time (e.g. shared_ptr reference counts become atomic once a second thread exists)
+    if (files.size() == 1 || ThreadPool::default_thread_count() == 1)
+    {
+        for (auto& file : files)
+            phase(file);
+
+        return;
+    }
+
+    auto& pool = ThreadPool::shared();
+    std::vector<std::future<void>> tasks;
+    tasks.reserve(files.size());
     for (auto& file : files)
-        emit(file);
+    {
+        tasks.push_back(pool.submit([&file, phase]
+        {
+            ErrorDeferral deferral;
+            phase(file);
+        }));
+    }
+
+    // every task is waited for even after a failure, since they all reference the files
+    std::exception_ptr first_failure;
+    for (auto& task : tasks)
+    {
+        try
+        {
+            pool.wait(task);
+        }
+        catch (...)
+        {
+            if (first_failure == nullptr)
+                first_failure = std::current_exception();
+        }
+    }
+
+    if (first_failure == nullptr)
+        return;
+
+    try
+    {
+        std::rethrow_exception(first_failure);
+    }
+    catch (const DeferredError& error)
+    {
+        report_deferred_error(error);
+    }
 }
 
-void Compiler::pre_emit(SourceFile& file)
+void Compiler::parse_file(SourceFile& file)
 {
     logger::info("Parsing file: " + file.path);
-    parse(file);
-    logger::info("Successfully parsed " + std::to_string(file.statements.size()) + " statements");
+    parse_recovering(file);
+    if (file.syntax_errors.empty())
+        logger::info("Successfully parsed " + std::to_string(file.statements.size()) + " statements");
+    else
+        logger::info("Parsed " + std::to_string(file.statements.size()) + " statements with "
+                     + std::to_string(file.syntax_errors.size()) + " syntax errors");
+}
 
+void Compiler::view(const SourceFile& file)
+{
     const auto viewer = new AstViewer;
     logger::info("Running AstViewer on parsed statements...");
     viewer->visit_statements(file.statements);
+}
 
+void Compiler::pre_emit(SourceFile& file)
+{
     const auto resolver = new Resolver;
-    resolver->visit_ast(file.statements);
-    logger::info("Successfully resolved AST");
-
-    const auto binder = new Binder;
-    binder->visit_ast(file.statements);
-    logger::info("Successfully bound AST");
+    resolver->walk_ast(file.statements);
+    logger::info("Successfully resolved and bound AST");
 
     const auto type_solver = new TypeSolver;
-    type_solver->visit_ast(file.statements);
+    type_solver->walk_ast(file.statements);
     logger::info("Successfully solved types for AST");
+}
 
+void Compiler::write_symbols(const SourceFile& file)
+{
     for (const auto& statement : file.statements)
         if (statement->symbol.has_value())
-            std::cout << typeid(*statement).name() << ": " << statement->symbol.value()->to_string() << '\n';
+            logger::write_line(typeid(*statement).name() + std::string(": ") + statement->symbol.value()->to_string());
 }
 
 void Compiler::emit(SourceFile& file)
@@ -47,20 +129,22 @@ void Compiler::emit(SourceFile& file)
     // TODO: transpilation
 }
 
-void compile_files(std::vector<SourceFile>& files)
+void compile_files(std::vector<SourceFile>& files, const bool view_ast)
 {
     auto compiler = Compiler(std::move(files));
+    compiler.view_ast = view_ast;
     compiler.emit();
 }
 
-void compile_file(const std::string& path)
+void compile_file(const std::string& path, const bool view_ast)
 {
     auto file = create_file(path);
-    compile_file(file);
+    compile_file(file, view_ast);
 }
 
-void compile_file(SourceFile& file)
+void compile_file(SourceFile& file, const bool view_ast)
 {
     auto compiler = Compiler(std::move(file));
+    compiler.view_ast = view_ast;
     compiler.emit();
 }
\ No newline at end of file
@@ -5,18 +5,53 @@
 #include <regex>
 
 #include "ion/diagnostics.h"
+#include "ion/logger.h"
 #include "ion/source_file.h"
 #include "ion/utility/basic.h"
 
+static thread_local bool errors_deferred = false;
+
 [[noreturn]] static void error(const std::string& message, const uint8_t code)
 {
-    std::cout << message << '\n';
+    if (errors_deferred)
+        throw DeferredError { message, code };
+
+    logger::write_line(message);
     exit(code);
 }
 
+ErrorDeferral::ErrorDeferral()
+    : was_deferring(errors_deferred)
+{
+    errors_deferred = true;
+}
+
+ErrorDeferral::~ErrorDeferral()
+{
+    errors_deferred = was_deferring;
+}
+
+[[noreturn]] void report_deferred_error(const DeferredError& deferred)
+{
+    error(deferred.message, deferred.code);
+}
+
+[[noreturn]] void report_deferred_errors(const std::vector<DeferredError>& deferred_errors)
+{
+    COMPILER_ASSERT(!deferred_errors.empty(), "Attempted to report an empty list of errors");
+    const auto& first = deferred_errors.front();
+    if (errors_deferred)
+        throw first;
+
+    for (size_t i = 0; i + 1 < deferred_errors.size(); i++)
+        logger::write_line(deferred_errors[i].message);
+
+    error(deferred_errors.back().message, first.code);
+}
+
 static void print(const std::string& message)
 {
-    std::cout << message << '\n';
+    logger::write_line(message);
 }
 
 constexpr const char* get_severity_color(const DiagnosticSeverity severity)
@@ -195,6 +230,11 @@ void report_no_variable_type_or_initializer(const FileSpan& span)
     report_error(19, span, NoVariableTypeOrInitializer {});
 }
 
+void report_nesting_too_deep(const FileSpan& span)
+{
+    report_error(20, span, NestingTooDeep {});
+}
+
 GENERATE_NODE_OVERLOADS(warn_unreachable_code);
 
 void warn_unreachable_code(const FileSpan& span)
@@ -260,6 +300,8 @@ constexpr std::string get_diagnostic_message(const Diagnostic& diagnostic)
             return "Duplicate " + arg.field_type + '.';
         else if constexpr (std::is_same_v<type_t, NoVariableTypeOrInitializer>)
             return std::string("Variable declarations must have, a type, an initializer, or both.");
+        else if constexpr (std::is_same_v<type_t, NestingTooDeep>)
+            return std::string("Expressions, statements or types are nested too deeply.");
         else if constexpr (std::is_same_v<type_t, UnreachableCode>)
             return std::string("Unreachable code.");
         else if constexpr (std::is_same_v<type_t, AmbiguousEquals>)
@@ -274,7 +316,7 @@ std::string format_diagnostic(const Diagnostic& diagnostic)
     const auto severity = format_severity(diagnostic.severity);
     const auto code = color(std::format("ION{:04}: ", diagnostic.code), Color::gray);
     const auto message = get_diagnostic_message(diagnostic);
-    const auto line_text = diagnostic.span.get_line();
+    const auto line_text = std::string(diagnostic.span.get_line());
     const auto span_text = diagnostic.span.get_text();
     const auto start_column = diagnostic.span.start.column;
     const auto underline_size = std::max<size_t>(1, diagnostic.span.end.column - start_column);
@@ -0,0 +1,74 @@
+#include <exception>
+
+#include "ion/large_stack.h"
+#include "ion/diagnostics.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#include <process.h>
+#else
+#include <pthread.h>
+#endif
+
+struct StackTask
+{
+    const std::function<void ()>* task;
+    std::exception_ptr failure;
+};
+
+static void run_stack_task(StackTask& stack_task)
+{
+    try
+    {
+        (*stack_task.task)();
+    }
+    catch (...)
+    {
+        stack_task.failure = std::current_exception();
+    }
+}
+
+#ifdef _WIN32
+static unsigned __stdcall start_stack_task(void* stack_task)
+{
+    run_stack_task(*static_cast<StackTask*>(stack_task));
+    return 0;
+}
+#else
+static void* start_stack_task(void* stack_task)
+{
+    run_stack_task(*static_cast<StackTask*>(stack_task));
+    return nullptr;
+}
+#endif
+
+void run_with_stack_size(const size_t stack_size, const std::function<void ()>& task)
+{
+    StackTask stack_task { &task, nullptr };
+#ifdef _WIN32
+    // only reserves the address space, pages are committed as the stack grows into them
+    const auto thread = reinterpret_cast<HANDLE>(_beginthreadex(nullptr, static_cast<unsigned>(stack_size), start_stack_task,
+                                                                &stack_task, STACK_SIZE_PARAM_IS_A_RESERVATION, nullptr));
+    if (thread == nullptr)
+        report_compiler_error("Failed to start a thread with a " + std::to_string(stack_size) + " byte stack");
+
+    WaitForSingleObject(thread, INFINITE);
+    CloseHandle(thread);
+#else
+    pthread_attr_t attributes;
+    pthread_attr_init(&attributes);
+    pthread_attr_setstacksize(&attributes, stack_size);
+    pthread_t thread;
+    const auto result = pthread_create(&thread, &attributes, start_stack_task, &stack_task);
+    pthread_attr_destroy(&attributes);
+    if (result != 0)
+        report_compiler_error("Failed to start a thread with a " + std::to_string(stack_size) + " byte stack");
+
+    pthread_join(thread, nullptr);
+#endif
+
+    if (stack_task.failure != nullptr)
+        std::rethrow_exception(stack_task.failure);
+}
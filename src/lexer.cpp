@@ -1,43 +1,51 @@
+#include <algorithm>
+#include <exception>
+#include <future>
+#include <numeric>
 #include <optional>
 #include <vector>
 
 #include "ion/diagnostics.h"
 #include "ion/logger.h"
 #include "ion/lexer.h"
+#include "ion/scanning.h"
 #include "ion/source_file.h"
+#include "ion/thread_pool.h"
 
 static void skip_whitespace(LexState& state)
 {
     LexemeGuard guard(state);
-    advance_while(state, is_whitespace);
+    advance_to(state, scanning::whitespace_end(state.file->text, state.position));
 }
 
 /** Advances until the current character is not a line feed */
 static void skip_newlines(LexState& state)
 {
     LexemeGuard guard(state);
-    state.line++;
     while (!is_eof(state) && current_character(state) == '\n')
-    {
         state.position++;
-        state.line++;
-    }
 
+    state.line = state.file->get_line_number(state.position);
     state.column = 0;
 }
 
 static void read_identifier_or_keyword(LexState& state)
 {
-    advance_while(state, [&](const auto character)
-    {
-        return is_valid_identifier_char(character, true);
-    });
-
-    const auto text = current_lexeme(state);
-    if (keyword_syntaxes.contains(text))
-        push_token(state, keyword_syntaxes.at(text));
+    advance_to(state, scanning::identifier_end(state.file->text, state.position));
+    if (const auto keyword_kind = find_keyword(current_lexeme(state)); keyword_kind.has_value())
+        push_token(state, *keyword_kind);
     else
-        push_token_override_text(state, SyntaxKind::Identifier, text);
+        push_identifier_token(state);
+}
+
+/** Decodes the current lexeme and pushes it as a number literal */
+static void push_number(LexState& state)
+{
+    const auto value = decode_number(current_lexeme(state));
+    if (!value.has_value())
+        malformed_number(state);
+
+    push_number_token(state, *value);
 }
 
 static void read_non_decimal_number(LexState& state, bool (*is_valid_digit)(const LexState&))
@@ -55,19 +63,19 @@ static void read_non_decimal_number(LexState& state, bool (*is_valid_digit)(cons
         malformed_number(state);
     }
 
-    push_token(state, SyntaxKind::NumberLiteral);
+    push_number(state);
 }
 
 static void read_decimal_number(LexState& state)
 {
     auto decimal_used = false;
     auto malformed = false;
-    auto character = current_character(state);
+    auto character = is_eof(state) ? '\0' : current_character(state);
     while (!is_eof(state) && (is_numeric_char(character) || character == '.'))
     {
         if (character == '.')
         {
-            if (!decimal_used && peek(state, 1) == '.')
+            if (!decimal_used && check(state, '.', 1))
                 break; // we have a range literal, stop right here and just return the current number
 
             malformed = decimal_used;
@@ -95,7 +103,7 @@ static void read_decimal_number(LexState& state)
         match(state, 'z'); // hz
     }
 
-    push_token(state, SyntaxKind::NumberLiteral);
+    push_number(state);
 }
 
 const std::vector hex_specifier = { 'x', 'X' };
@@ -121,24 +129,39 @@ static void read_string(LexState& state, const char terminator)
 {
     auto was_interpolated = false;
     auto is_interpolation = false;
-    auto character = current_character(state);
+    auto character = is_eof(state) ? '\0' : current_character(state);
     while (!is_eof(state) && character != terminator && character != '\n')
     {
+        if (character != '#' && character != '}')
+        {
+            // skip straight to the next character that could end the string or start/end an interpolation
+            advance_to(state, scanning::string_body_end(state.file->text, state.position + 1, terminator));
+            if (is_eof(state))
+                break;
+
+            character = current_character(state);
+            continue;
+        }
+
         if (character == '#' && check(state, '{', 1))
         {
             was_interpolated = true;
             is_interpolation = true;
             const auto lexeme = current_lexeme(state);
-            const auto text = unescape(lexeme.empty() ? lexeme : lexeme.substr(1));
+            const auto text = unescape(lexeme.empty() ? lexeme : lexeme.substr(1), *state.string_arena);
             push_token_override_text(state, SyntaxKind::InterpolatedStringPart, text);
-            character = *advance(state, 2);
+            advance(state, 2);
             push_token(state, SyntaxKind::InterpolationStart);
 
-            do
+            // a file that ends inside the interpolation leaves the string unterminated
+            while (!is_eof(state))
             {
                 lex(state);
-                character = current_character(state);
-            } while (!check(state, '}'));
+                if (check(state, '}'))
+                    break;
+            }
+
+            character = is_eof(state) ? '\0' : current_character(state);
             continue;
         }
 
@@ -154,13 +177,14 @@ static void read_string(LexState& state, const char terminator)
             }
         }
 
-        character = *advance(state);
+        // a file can end right after a '#' or '}', which leaves the string unterminated
+        character = advance(state).value_or('\0');
     }
 
     advance(state);
-    const auto text = unescape(current_lexeme(state));
+    const auto text = unescape(current_lexeme(state), *state.string_arena);
     if (character != terminator)
-        report_unterminated_string(current_span(state), text);
+        report_unterminated_string(current_span(state), std::string(text));
 
     const auto kind = was_interpolated ? SyntaxKind::InterpolatedStringPart : SyntaxKind::StringLiteral;
     push_token_override_text(state, kind, was_interpolated ? text.substr(0, text.size() - 1) : text);
@@ -169,37 +193,31 @@ static void read_string(LexState& state, const char terminator)
 static void skip_single_line_comment(LexState& state)
 {
     LexemeGuard guard(state);
-    advance_while(state, [&](const auto character)
-    {
-        return character != '\n';
-    });
+    advance_to(state, scanning::line_end(state.file->text, state.position));
 }
 
-static void read_operator(LexState& state, const char character)
+/** Walks the operator DFA from `operator_state` for as long as it has a transition */
+static void read_operator(LexState& state, unsigned char operator_state)
 {
-    const auto& [base, continuations] = operator_rules.at(character);
-    auto kind = base;
-
-    for (const auto& [pattern, next_kind] : continuations)
+    advance(state);
+    while (!is_eof(state))
     {
-        if (match_sequential(state, pattern))
-        {
-            kind = next_kind;
+        const auto next_state = operator_dfa.transitions[operator_state][static_cast<unsigned char>(peek(state, 0))];
+        if (next_state == 0)
             break;
-        }
-    }
 
-    if (kind == base)
+        operator_state = next_state;
         advance(state);
+    }
 
-    push_token(state, kind);
+    push_token(state, operator_dfa.accepted_kinds[operator_state]);
 }
 
 void lex(LexState& state)
 {
     const auto character = current_character(state);
-    if (operator_rules.contains(character))
-        return read_operator(state, character);
+    if (const auto operator_state = operator_start_state(character); operator_state != 0)
+        return read_operator(state, operator_state);
 
     advance(state);
     if (character == '"' || character == '\'')
@@ -215,23 +233,261 @@ void lex(LexState& state)
     if (is_numeric_char(character))
         return read_number(state, character);
     if (single_character_syntaxes.contains(character))
-        return push_token_override_text(state, single_character_syntaxes.at(character), std::string(1, character));
+        return push_token(state, single_character_syntaxes.at(character));
 
     report_unexpected_character(current_span(state), character);
 }
 
-std::vector<Token> tokenize(const SourceFile& file)
+bool lex_next(LexState& state)
+{
+    const auto token_count = state.tokens.size();
+    while (!is_eof(state) && state.tokens.size() == token_count)
+        lex(state);
+
+    return state.tokens.size() != token_count;
+}
+
+/** Lexes the characters in [`start`, `end`), which must start and end at the start of a line outside any interpolation */
+static TokenTable lex_chunk(const SourceFile& file, const size_t start, const size_t end, StringArena& string_arena)
+{
+    const auto start_location = file.get_location(static_cast<int>(start));
+    auto state = LexState { start_location, start_location, {}, &string_arena };
+
+    // tokens are only staged in `state.tokens` until they are packed into the table
+    TokenTable tokens(file);
+    while (state.position < static_cast<int>(end))
+    {
+        lex(state);
+        for (const auto& token : state.tokens)
+            tokens.push(token);
+
+        state.tokens.clear();
+    }
+
+    return tokens;
+}
+
+/**
+ * Finds positions to split `text` at so that no token spans two chunks: line starts that aren't inside an interpolation
+ * and don't directly follow another line feed (so a run of line feeds is never split).
+ * Returns the start of every chunk followed by the end of the text.
+ */
+static std::vector<size_t> find_chunk_boundaries(const std::string_view text, const size_t chunk_count)
+{
+    std::vector<size_t> boundaries = { 0 };
+    std::vector<char> interpolated_string_terminators;
+    auto in_string = false;
+    auto terminator = '\0';
+    size_t position = 0;
+    while (position < text.size() && boundaries.size() < chunk_count)
+    {
+        if (in_string)
+        {
+            position = scanning::string_body_end(text, position, terminator);
+            if (position >= text.size())
+                break;
+
+            const auto character = text[position++];
+            if (character == terminator || character == '\n')
+                in_string = false; // a line feed means the string is unterminated, which the lexer will report
+            else if (character == '#' && position < text.size() && text[position] == '{')
+            {
+                interpolated_string_terminators.push_back(terminator);
+                in_string = false;
+                position++;
+            }
+
+            continue;
+        }
+
+        const auto character = text[position++];
+        if (character == '"' || character == '\'')
+        {
+            in_string = true;
+            terminator = character;
+        }
+        else if (character == '#' && position < text.size() && text[position] == '#')
+            position = scanning::line_end(text, position);
+        else if (character == '}' && !interpolated_string_terminators.empty())
+        {
+            in_string = true;
+            terminator = interpolated_string_terminators.back();
+            interpolated_string_terminators.pop_back();
+        }
+        else if (character == '\n' && interpolated_string_terminators.empty() && position < text.size() && text[position] != '\n')
+        {
+            const auto target = text.size() / chunk_count * boundaries.size();
+            if (position >= target)
+                boundaries.push_back(position);
+        }
+    }
+
+    boundaries.push_back(text.size());
+    return boundaries;
+}
+
+TokenTable tokenize_chunked(const SourceFile& file, const size_t chunk_count)
+{
+    const auto boundaries = find_chunk_boundaries(file.text, std::max<size_t>(1, chunk_count));
+    const auto actual_chunk_count = boundaries.size() - 1;
+    if (actual_chunk_count <= 1)
+        return lex_chunk(file, 0, file.text.size(), file.string_arena);
+
+    // the file's arena isn't thread-safe, so each chunk gets its own and they are merged afterwards
+    std::vector<StringArena> string_arenas(actual_chunk_count);
+    std::vector<std::future<TokenTable>> chunks;
+    chunks.reserve(actual_chunk_count);
+    for (size_t i = 0; i < actual_chunk_count; i++)
+    {
+        chunks.push_back(ThreadPool::shared().submit([&, i]
+        {
+            ErrorDeferral deferral;
+            return lex_chunk(file, boundaries[i], boundaries[i + 1], string_arenas[i]);
+        }));
+    }
+
+    // collect in order, so that if several chunks fail the error that sequential lexing would have hit is reported
+    // every chunk is waited for even after a failure, since they all reference this frame
+    TokenTable tokens(file);
+    std::exception_ptr first_failure;
+    for (auto& chunk : chunks)
+    {
+        try
+        {
+            const auto chunk_tokens = ThreadPool::shared().wait(chunk);
+            if (first_failure == nullptr)
+                tokens.append(chunk_tokens);
+        }
+        catch (...)
+        {
+            if (first_failure == nullptr)
+                first_failure = std::current_exception();
+        }
+    }
+
+    if (first_failure != nullptr)
+    {
+        try
+        {
+            std::rethrow_exception(first_failure);
+        }
+        catch (const DeferredError& error)
+        {
+            report_deferred_error(error);
+        }
+    }
+
+    for (auto& string_arena : string_arenas)
+        file.string_arena.absorb(std::move(string_arena));
+
+    return tokens;
+}
+
+size_t lexing_chunk_count(const SourceFile& file)
+{
+    return file.text.size() >= parallel_lexing_threshold
+               ? std::min(ThreadPool::shared().size(), file.text.size() / min_lexing_chunk_size)
+               : 1;
+}
+
+TokenTable tokenize(const SourceFile& file)
 {
     logger::info("Lexing file: " + file.path);
-    auto state = LexState {
-        { .file = &file },
-        get_start_location(file),
-        {}
+    auto tokens = tokenize_chunked(file, lexing_chunk_count(file));
+    logger::info("Lexed " + std::to_string(tokens.size()) + " tokens");
+    return tokens;
+}
+
+/** How a token changes the interpolation depth */
+static int interpolation_depth_change(const SyntaxKind kind)
+{
+    return kind == SyntaxKind::InterpolationStart ? 1 : kind == SyntaxKind::InterpolationEnd ? -1 : 0;
+}
+
+/** Whether the lexer is outside any string between two tokens, given the interpolation depth and the kinds around it */
+static bool is_restartable(const int interpolation_depth, const std::optional<SyntaxKind> previous_kind,
+                           const std::optional<SyntaxKind> kind)
+{
+    // a string part before an interpolation, or the rest of a string after one, still belongs to the string
+    return interpolation_depth == 0 && previous_kind != SyntaxKind::InterpolationEnd && kind != SyntaxKind::InterpolationStart;
+}
+
+TokenSplice relex(SourceFile& file, TokenTable& tokens, const SourceEdit& edit)
+{
+    const auto& kinds = tokens.get_kinds();
+    const auto old_count = static_cast<token_index_t>(tokens.size());
+    const auto offset_delta = static_cast<int64_t>(edit.replacement.size()) - static_cast<int64_t>(edit.end - edit.start);
+
+    // tokens before `restart` were decided by unedited characters only (the lexer looks at most 2 characters past a token)
+    auto restart = tokens.find_first_ending_at(edit.start > 1 ? edit.start - 1 : 0);
+    auto depth = std::accumulate(kinds.begin(), kinds.begin() + restart, 0, [](const int total, const SyntaxKind kind)
+    {
+        return total + interpolation_depth_change(kind);
+    });
+
+    const auto previous_kind = [&](const token_index_t index) -> std::optional<SyntaxKind>
+    {
+        return index > 0 ? std::optional(kinds[index - 1]) : std::nullopt;
     };
 
-    while (!is_eof(state))
+    const auto kind_at = [&](const token_index_t index) -> std::optional<SyntaxKind>
+    {
+        return index < old_count ? std::optional(kinds[index]) : std::nullopt;
+    };
+
+    while (restart > 0 && !is_restartable(depth, previous_kind(restart), kind_at(restart)))
+        depth -= interpolation_depth_change(kinds[--restart]);
+
+    // lexing restarts right after the last kept token, so whitespace and comments in between are read again too
+    const auto restart_offset = restart > 0 ? tokens.get_offset(restart - 1) + tokens.get_length(restart - 1) : 0;
+
+    file.apply(edit);
+    const auto edit_end = edit.start + edit.replacement.size();
+    const auto start_location = file.get_location(static_cast<int>(restart_offset));
+    auto state = LexState { start_location, start_location, {}, &file.string_arena };
+
+    // both streams are lexed from the same state at `restart`, they line up again once both are outside any string at the same
+    // (shifted) token after the edit
+    TokenTable relexed(file);
+    auto old_index = restart;
+    auto old_depth = 0;
+    auto old_previous_kind = previous_kind(restart);
+    auto new_depth = 0;
+    auto new_previous_kind = old_previous_kind;
+    auto resynchronized = false;
+    while (!resynchronized && !is_eof(state))
+    {
         lex(state);
+        for (const auto& token : state.tokens)
+        {
+            const auto start = static_cast<int64_t>(token.span.start.position);
+            if (start >= static_cast<int64_t>(edit_end) && is_restartable(new_depth, new_previous_kind, token.kind))
+            {
+                while (old_index < old_count && tokens.get_offset(old_index) + offset_delta < start)
+                {
+                    old_depth += interpolation_depth_change(kinds[old_index]);
+                    old_previous_kind = kinds[old_index++];
+                }
+
+                resynchronized = old_index < old_count
+                                 && tokens.get_offset(old_index) + offset_delta == start
+                                 && is_restartable(old_depth, old_previous_kind, kinds[old_index]);
+
+                if (resynchronized)
+                    break;
+            }
+
+            relexed.push(token);
+            new_depth += interpolation_depth_change(token.kind);
+            new_previous_kind = token.kind;
+        }
 
-    logger::info("Lexed " + std::to_string(state.tokens.size()) + " tokens");
-    return state.tokens;
-}
\ No newline at end of file
+        state.tokens.clear();
+    }
+
+    if (!resynchronized)
+        old_index = old_count;
+
+    tokens.splice(restart, old_index, relexed, offset_delta);
+    return TokenSplice { restart, old_index - restart, relexed.size() };
+}
@@ -1,5 +1,6 @@
 #include <chrono>
 #include <iostream>
+#include <mutex>
 
 #include "ion/logger.h"
 #include "ion/utility/basic.h"
@@ -9,11 +10,18 @@ static void log(const std::string& tag, const std::string& message)
     using namespace std::chrono;
 
     const auto time_stamp = color(std::format("{:%H:%M:%S}", floor<seconds>(system_clock::now())), Color::gray);
-    std::cout << "[" << time_stamp << " " << tag << "] " << message << '\n';
+    logger::write_line("[" + time_stamp + " " + tag + "] " + message);
 }
 
 namespace logger
 {
+    void write_line(const std::string& line)
+    {
+        static std::mutex output_mutex;
+        std::lock_guard lock(output_mutex);
+        std::cout << line << '\n';
+    }
+
     void info(const std::string& message)
     {
         log(color("INFO", Color::light_blue), message);
@@ -1,7 +1,11 @@
+#include <string_view>
+
 #include "ion/compiler.h"
 #include "ion/source_file.h"
 
-int main()
+/** Usage: Ion [--no-view-ast] */
+int main(const int argc, char** argv)
 {
-    compile_file("test.ion");
-}
\ No newline at end of file
+    const auto view_ast = argc < 2 || std::string_view(argv[1]) != "--no-view-ast";
+    compile_file("test.ion", view_ast);
+}
@@ -103,21 +103,20 @@ static FunctionBody* parse_function_body(ParseState& state)
     std::optional<statement_ptr_t> block = std::nullopt;
 
     if (long_arrow.has_value())
-        expression_body = new ExpressionBody(*long_arrow, parse_expression(state));
+        expression_body = create_node<ExpressionBody>(*long_arrow, parse_expression(state));
     else if (check(state, SyntaxKind::LBrace))
         block = parse_block(state);
     else
     {
-        const auto last_token = peek(state, -1);
+        const auto location = peek(state, -1).span.end;
         const auto token = current_token(state);
-        const auto location = last_token.span.end;
         const auto span = create_span(location, location);
-        const auto text = token.has_value() ? token->get_text() : "EOF";
+        const auto text = token != nullptr ? token->get_text() : "EOF";
 
-        report_expected_different_syntax(span, "function body", text, false);
+        report_expected_different_syntax(span, "function body", std::string(text), false);
     }
 
-    return new FunctionBody(expression_body, std::move(block));
+    return create_node<FunctionBody>(expression_body, std::move(block));
 }
 
 static statement_ptr_t parse_function_declaration(ParseState& state, const std::optional<Token>& async_keyword,
@@ -188,13 +187,13 @@ statement_ptr_t parse_declaration(ParseState& state)
 
     std::optional<Token> export_keyword = std::nullopt;
     if (match(state, SyntaxKind::ExportKeyword))
-        export_keyword = previous_token(state);
+        export_keyword = previous_token_guaranteed(state);
 
     std::optional<Token> async_keyword = std::nullopt;
     const auto is_sync_function = check(state, SyntaxKind::FnKeyword);
     const auto is_async_function = check(state, SyntaxKind::AsyncKeyword) && check(state, SyntaxKind::FnKeyword, 1);
     if (is_async_function)
-        async_keyword = advance(state);
+        async_keyword = *advance(state);
 
     std::optional<statement_ptr_t> statement = std::nullopt;
     if (match(state, SyntaxKind::LetKeyword))
@@ -217,7 +216,8 @@ statement_ptr_t parse_declaration(ParseState& state)
         if (statement.has_value())
             report_invalid_decorator_target(*statement);
 
-        report_invalid_decorator_target(current_token(state).value_or(previous_token_guaranteed(state)));
+        const auto token = current_token(state);
+        report_invalid_decorator_target(token != nullptr ? *token : previous_token_guaranteed(state));
     }
 
     if (export_keyword.has_value())
@@ -7,7 +7,7 @@ std::optional<EqualsValueClause*> parse_equals_value_clause(ParseState& state)
         return std::nullopt;
 
     auto value = parse_expression(state);
-    return new EqualsValueClause(*equals_token, std::move(value));
+    return create_node<EqualsValueClause>(*equals_token, std::move(value));
 }
 
 template <typename NodeFactory, typename... Args>
@@ -103,12 +103,11 @@ static expression_ptr_t parse_primary(ParseState& state)
     if (check(state, SyntaxKind::LArrow))
         return parse_vector_literal(state);
 
-    const auto token_opt = advance(state);
-    if (!token_opt.has_value())
+    const auto token_ptr = advance(state);
+    if (token_ptr == nullptr)
         report_unexpected_eof(span);
 
-    const auto& token = *token_opt;
-    const auto text = token.get_text();
+    const auto token = *token_ptr;
     switch (token.kind)
     {
         case SyntaxKind::Identifier:
@@ -128,12 +127,12 @@ static expression_ptr_t parse_primary(ParseState& state)
         case SyntaxKind::FalseKeyword:
         case SyntaxKind::StringLiteral:
         case SyntaxKind::NumberLiteral:
-            return PrimitiveLiteral::create(token, primitive_from_string(text));
+            return PrimitiveLiteral::create(token, primitive_from_token(token));
         case SyntaxKind::NullKeyword:
             return PrimitiveLiteral::create(token, std::nullopt);
 
         default:
-            report_expected_different_syntax(token.span, "expression", token.get_text(), false);
+            report_expected_different_syntax(token.span, "expression", std::string(token.get_text()), false);
     }
 }
 
@@ -265,35 +264,55 @@ static expression_ptr_t parse_unary(ParseState& state)
     return parse_postfix(state);
 }
 
-DEFINE_BINARY_PARSER(parse_exponentiation, parse_unary, SyntaxKind::Caret);
-DEFINE_BINARY_PARSER(parse_multiplication, parse_exponentiation, multiplicative_syntaxes);
-DEFINE_BINARY_PARSER(parse_addition, parse_multiplication, additive_syntaxes);
-DEFINE_BINARY_PARSER(parse_bit_shift, parse_addition, bit_shift_syntaxes);
-DEFINE_BINARY_PARSER(parse_bitwise_and, parse_bit_shift, SyntaxKind::Ampersand);
-DEFINE_BINARY_PARSER(parse_bitwise_xor, parse_bitwise_and, SyntaxKind::Tilde);
-DEFINE_BINARY_PARSER(parse_bitwise_or, parse_bitwise_xor, SyntaxKind::Pipe);
-
-static expression_ptr_t parse_range_literal(ParseState& state)
+/**
+ * Precedence climbing over `binary_binding_powers`. Operators still waiting for their right operand are kept on a stack
+ * instead of recursing into each operand, so chains of right associative operators don't nest the parser.
+ */
+static expression_ptr_t parse_binary(ParseState& state)
 {
-    auto left = parse_bitwise_or(state);
-    while (match(state, SyntaxKind::DotDot))
+    struct PendingOperator
     {
-        const auto dot_dot_token = previous_token_guaranteed(state);
-        auto right = parse_bitwise_or(state);
-        left = RangeLiteral::create(std::move(left), dot_dot_token, std::move(right));
-    }
+        expression_ptr_t left;
+        Token operator_token;
+        /** The binding power the operands around this operator had to bind at least as tightly as */
+        uint8_t min_binding_power;
+    };
+
+    std::vector<PendingOperator> pending;
+    uint8_t min_binding_power = 0;
+    auto operand = parse_unary(state);
+    while (true)
+    {
+        const auto next_token = current_token(state);
+        const auto binding_power = next_token != nullptr
+                                       ? binary_binding_powers[static_cast<size_t>(next_token->kind)]
+                                       : BindingPower {};
 
-    return left;
-}
+        if (binding_power.left != 0 && binding_power.left >= min_binding_power)
+        {
+            pending.push_back({ std::move(operand), *advance(state), min_binding_power });
+            min_binding_power = binding_power.right;
+            operand = parse_unary(state);
+            continue;
+        }
+
+        if (pending.empty())
+            return operand;
 
-DEFINE_BINARY_PARSER(parse_comparison, parse_range_literal, comparison_syntaxes);
-DEFINE_BINARY_PARSER(parse_logical_and, parse_comparison, SyntaxKind::AmpersandAmpersand);
-DEFINE_BINARY_PARSER(parse_logical_or, parse_logical_and, SyntaxKind::PipePipe);
-DEFINE_BINARY_PARSER(parse_null_coalesce, parse_logical_or, SyntaxKind::QuestionQuestion);
+        // nothing binds to `operand` more tightly, so it's the right operand of the innermost pending operator
+        auto [left, operator_token, outer_min_binding_power] = std::move(pending.back());
+        pending.pop_back();
+        operand = operator_token.is_kind(SyntaxKind::DotDot)
+                      ? RangeLiteral::create(std::move(left), operator_token, std::move(operand))
+                      : BinaryOp::create(operator_token, std::move(left), std::move(operand));
+
+        min_binding_power = outer_min_binding_power;
+    }
+}
 
 static expression_ptr_t parse_ternary_op(ParseState& state)
 {
-    auto condition = parse_null_coalesce(state);
+    auto condition = parse_binary(state);
     while (match(state, SyntaxKind::Question))
     {
         const auto question_token = previous_token_guaranteed(state);
@@ -323,5 +342,8 @@ static expression_ptr_t parse_assignment(ParseState& state)
 
 expression_ptr_t parse_expression(ParseState& state)
 {
-    return parse_assignment(state);
+    return parse_nested(state, [&]
+    {
+        return parse_assignment(state);
+    });
 }
\ No newline at end of file
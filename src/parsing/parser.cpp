@@ -3,13 +3,35 @@
 #include "ion/lexer.h"
 #include "ion/parsing/parser.h"
 
-void parse(SourceFile& file)
+void parse_recovering(SourceFile& file)
 {
-    const auto tokens = tokenize(file);
-    auto state = ParseState { .file = &file, .token_stream = tokens };
-    while (!is_eof(state))
-        file.statements.push_back(parse_statement(state));
+    logger::info("Lexing file: " + file.path);
+    AstArenaScope arena_scope(file.ast_arena);
+    auto state = ParseState { .file = &file, .token_stream = TokenStream(file) };
+    {
+        // syntax errors throw so that the statement they're in can recover from them
+        ErrorDeferral deferral;
+        try
+        {
+            while (!is_eof(state))
+                file.statements.push_back(parse_statement(state));
+        }
+        catch (DeferredError& error)
+        {
+            // only lexer errors and nesting that's too deep can escape a statement, and neither can be parsed past
+            state.errors.push_back(std::move(error));
+        }
+    }
 
+    file.syntax_errors = std::move(state.errors);
+    logger::info("Lexed " + std::to_string(state.token_stream.lexed_count()) + " tokens");
     logger::info("Checking for unreachable code at module level");
     check_for_unreachable_code(file.statements);
-}
\ No newline at end of file
+}
+
+void parse(SourceFile& file)
+{
+    parse_recovering(file);
+    if (!file.syntax_errors.empty())
+        report_deferred_errors(file.syntax_errors);
+}
@@ -5,31 +5,40 @@ BracedStatementList* parse_braced_statement_list(ParseState& state,
                                                  const bool comma_allowed)
 {
     const auto l_brace = expect(state, SyntaxKind::LBrace);
-    std::vector<statement_ptr_t> statements;
-
-    while (!check(state, SyntaxKind::RBrace))
+    auto statements = parse_nested(state, [&]
     {
-        statements.push_back(parse_list_statement(state));
-        if (comma_allowed)
-            match(state, SyntaxKind::Comma);
-    }
+        std::vector<statement_ptr_t> list;
+        while (!is_eof(state) && !check(state, SyntaxKind::RBrace))
+        {
+            list.push_back(parse_list_statement(state));
+            if (comma_allowed)
+                match(state, SyntaxKind::Comma);
+        }
+
+        return list;
+    });
 
     const auto r_brace = expect(state, SyntaxKind::RBrace);
-    return new BracedStatementList(l_brace, std::move(statements), r_brace);
+    return create_node<BracedStatementList>(l_brace, std::move(statements), r_brace);
 }
 
 BracedStatementList* parse_braced_statement_list_comma_separated(ParseState& state,
                                                                  const std::function<statement_ptr_t (ParseState&)>& parse_list_statement)
 {
     const auto l_brace = expect(state, SyntaxKind::LBrace);
-    std::vector<statement_ptr_t> statements;
-    if (!check(state, SyntaxKind::RBrace))
-        do
-            statements.push_back(parse_list_statement(state));
-        while (match(state, SyntaxKind::Comma));
+    auto statements = parse_nested(state, [&]
+    {
+        std::vector<statement_ptr_t> list;
+        if (!check(state, SyntaxKind::RBrace))
+            do
+                list.push_back(parse_list_statement(state));
+            while (match(state, SyntaxKind::Comma));
+
+        return list;
+    });
 
     const auto r_brace = expect(state, SyntaxKind::RBrace);
-    return new BracedStatementList(l_brace, std::move(statements), r_brace);
+    return create_node<BracedStatementList>(l_brace, std::move(statements), r_brace);
 }
 
 statement_ptr_t parse_block(ParseState& state)
@@ -60,7 +69,7 @@ ParameterListClause* parse_parameter_list(ParseState& state)
         while (match(state, SyntaxKind::Comma));
 
     const auto r_paren = expect(state, SyntaxKind::RParen);
-    return new ParameterListClause(l_paren, std::move(list), r_paren);
+    return create_node<ParameterListClause>(l_paren, std::move(list), r_paren);
 }
 
 static statement_ptr_t parse_decorator(ParseState& state)
@@ -90,26 +99,65 @@ std::vector<statement_ptr_t> parse_decorator_list(ParseState& state)
     return list;
 }
 
+/** Parses the statement a compound statement runs, one that isn't a block is nested just as deeply as a block is */
+static statement_ptr_t parse_body(ParseState& state)
+{
+    if (check(state, SyntaxKind::LBrace))
+        return parse_statement(state);
+
+    return parse_nested(state, [&]
+    {
+        return parse_statement(state);
+    });
+}
+
+/** Parses an `if` and every `else if` chained onto it in one loop, so long chains don't nest the parser */
 static statement_ptr_t parse_if(ParseState& state)
 {
-    const auto if_keyword = previous_token_guaranteed(state);
-    auto condition = parse_expression(state);
-    check_for_ambiguous_equals(condition);
+    struct Branch
+    {
+        Token if_keyword;
+        expression_ptr_t condition;
+        statement_ptr_t then_branch;
+        std::optional<Token> else_keyword;
+    };
 
-    auto then_branch = parse_statement(state);
-    const auto else_keyword = try_consume(state, SyntaxKind::ElseKeyword);
+    std::vector<Branch> branches;
     std::optional<statement_ptr_t> else_branch = std::nullopt;
-    if (else_keyword.has_value())
-        else_branch = parse_statement(state);
+    auto if_keyword = previous_token_guaranteed(state);
+    while (true)
+    {
+        auto condition = parse_expression(state);
+        check_for_ambiguous_equals(condition);
+
+        auto then_branch = parse_body(state);
+        const auto else_keyword = try_consume(state, SyntaxKind::ElseKeyword);
+        branches.push_back({ if_keyword, std::move(condition), std::move(then_branch), else_keyword });
+        if (!else_keyword.has_value())
+            break;
+
+        if (!match(state, SyntaxKind::IfKeyword))
+        {
+            else_branch = parse_body(state);
+            break;
+        }
 
-    return If::create(if_keyword, std::move(condition), std::move(then_branch), else_keyword, std::move(else_branch));
+        if_keyword = previous_token_guaranteed(state);
+    }
+
+    // each `if` is the else branch of the one before it, so they're created from the last one back
+    for (auto branch = branches.rbegin(); branch != branches.rend(); ++branch)
+        else_branch = If::create(branch->if_keyword, std::move(branch->condition), std::move(branch->then_branch),
+                                 branch->else_keyword, std::move(else_branch));
+
+    return std::move(*else_branch);
 }
 
 static statement_ptr_t parse_while(ParseState& state)
 {
     const auto keyword = previous_token_guaranteed(state);
     auto condition = parse_expression(state);
-    auto statement = parse_statement(state);
+    auto statement = parse_body(state);
     check_for_ambiguous_equals(condition);
 
     return While::create(keyword, std::move(condition), std::move(statement));
@@ -118,7 +166,7 @@ static statement_ptr_t parse_while(ParseState& state)
 static statement_ptr_t parse_repeat(ParseState& state)
 {
     const auto repeat_keyword = previous_token_guaranteed(state);
-    auto statement = parse_statement(state);
+    auto statement = parse_body(state);
     const auto while_keyword = expect(state, SyntaxKind::WhileKeyword);
     auto condition = parse_expression(state);
     check_for_ambiguous_equals(condition);
@@ -131,8 +179,8 @@ static std::vector<Token> parse_name_list(ParseState& state)
     std::vector<Token> names;
     do
     {
-        const auto name = try_consume(state, SyntaxKind::Star).value_or(expect(state, SyntaxKind::Identifier));
-        names.push_back(name);
+        const auto star_token = try_consume(state, SyntaxKind::Star);
+        names.push_back(star_token.has_value() ? *star_token : expect(state, SyntaxKind::Identifier));
     } while (match(state, SyntaxKind::Comma));
 
     return names;
@@ -144,7 +192,7 @@ static statement_ptr_t parse_for(ParseState& state)
     const auto names = parse_name_list(state);
     const auto colon_token = expect(state, SyntaxKind::Colon);
     auto iterable = parse_expression(state);
-    auto statement = parse_statement(state);
+    auto statement = parse_body(state);
 
     return For::create(keyword, names, colon_token, std::move(iterable), std::move(statement));
 }
@@ -153,7 +201,7 @@ static statement_ptr_t parse_after(ParseState& state)
 {
     const auto keyword = previous_token_guaranteed(state);
     auto time_expression = parse_expression(state);
-    auto statement = parse_statement(state);
+    auto statement = parse_body(state);
 
     return After::create(keyword, std::move(time_expression), std::move(statement));
 }
@@ -164,7 +212,7 @@ static statement_ptr_t parse_every(ParseState& state)
     auto time_expression = parse_expression(state);
     const auto while_keyword = try_consume(state, SyntaxKind::WhileKeyword);
     auto condition = parse_expression(state);
-    auto statement = parse_statement(state);
+    auto statement = parse_body(state);
 
     return Every::create(every_keyword, std::move(time_expression), while_keyword, std::move(condition), std::move(statement));
 }
@@ -231,8 +279,9 @@ static statement_ptr_t parse_import(ParseState& state)
         }
         else
         {
-            const auto token = current_token(state).value_or(import_keyword);
-            report_expected_different_syntax(import_keyword.span, "import name", token.get_text(), false);
+            const auto token = current_token(state);
+            const auto text = token != nullptr ? token->get_text() : import_keyword.get_text();
+            report_expected_different_syntax(import_keyword.span, "import name", std::string(text), false);
         }
     }
 
@@ -246,8 +295,9 @@ static statement_ptr_t parse_return(ParseState& state)
     const auto keyword = previous_token_guaranteed(state);
     std::optional<expression_ptr_t> expression = std::nullopt;
 
-    const auto has_line_break_between = keyword.span.has_line_break_between(current_token_guaranteed(state));
-    if (!is_eof(state) && !check(state, SyntaxKind::Semicolon) && !has_line_break_between)
+    if (!is_eof(state)
+        && !check(state, SyntaxKind::Semicolon)
+        && !keyword.span.has_line_break_between(current_token_guaranteed(state)))
         expression = parse_expression(state);
 
     return Return::create(keyword, std::move(expression));
@@ -285,7 +335,65 @@ static const std::unordered_map<SyntaxKind, std::function<statement_ptr_t (Parse
     { SyntaxKind::ContinueKeyword, parse_continue }
 };
 
-statement_ptr_t parse_statement(ParseState& state)
+/** Tokens that can only begin a declaration, see `parse_declaration` */
+static constexpr SyntaxKindSet declaration_start_syntaxes = {
+    SyntaxKind::ExportKeyword, SyntaxKind::AsyncKeyword, SyntaxKind::LetKeyword, SyntaxKind::FnKeyword, SyntaxKind::EventKeyword,
+    SyntaxKind::TypeKeyword, SyntaxKind::EnumKeyword, SyntaxKind::InterfaceKeyword, SyntaxKind::InstanceKeyword
+};
+
+static bool is_statement_start(const Token& token)
+{
+    return statement_parsers.contains(token.kind) || declaration_start_syntaxes.contains(token.kind);
+}
+
+/** Skips to the close of the braces opened past `depth`, along with the semicolons that end the statement after it */
+static void skip_to_brace_depth(ParseState& state, const int depth)
+{
+    while (state.brace_depth > depth && advance(state) != nullptr)
+        continue;
+
+    consume_semicolons(state);
+}
+
+/**
+ * Skips the rest of a statement that failed to parse. Braces it opened are skipped up to their close, which also ends it,
+ * otherwise it ends after a `;` or before a `}` of the enclosing block or a token that starts another statement.
+ * At least one token is always skipped so that recovery can't loop.
+ */
+static void synchronize(ParseState& state, const int start_position, const int start_depth)
+{
+    if (state.position == start_position)
+        advance(state);
+
+    // the token an error is reported at has usually been consumed already, so resume at it if it starts a statement
+    if (state.position - 1 > start_position && !is_eof(state, -1) && is_statement_start(previous_token_guaranteed(state)))
+    {
+        state.position--;
+        return;
+    }
+
+    if (state.brace_depth > start_depth)
+        return skip_to_brace_depth(state, start_depth);
+
+    if (!is_eof(state, -1) && previous_token_guaranteed(state).is_kind(SyntaxKind::Semicolon))
+        return;
+
+    while (const auto token = current_token(state))
+    {
+        if (token->is_kind(SyntaxKind::RBrace) || is_statement_start(*token))
+            return;
+
+        const auto kind = token->kind;
+        advance(state);
+        if (kind == SyntaxKind::Semicolon)
+            return;
+
+        if (kind == SyntaxKind::LBrace)
+            return skip_to_brace_depth(state, start_depth);
+    }
+}
+
+static statement_ptr_t parse_statement_unrecovered(ParseState& state)
 {
     if (check(state, SyntaxKind::LBrace))
         return parse_block(state);
@@ -304,4 +412,40 @@ statement_ptr_t parse_statement(ParseState& state)
     consume_semicolons(state);
 
     return declaration;
-}
\ No newline at end of file
+}
+
+/** Parses a statement, or records the syntax error it has and returns an `ErrorStatement` for what was skipped to recover */
+statement_ptr_t parse_statement(ParseState& state)
+{
+    if (is_eof(state))
+        return parse_statement_unrecovered(state);
+
+    const auto start_position = state.position;
+    const auto start_depth = state.brace_depth;
+    const auto first_token = current_token_guaranteed(state);
+    try
+    {
+        return parse_statement_unrecovered(state);
+    }
+    catch (DeferredError& error)
+    {
+        // every statement this one is nested in is just as deep, so there's nowhere to recover at
+        if (state.nested_too_deep)
+            throw;
+
+        // every block still open at the end of the file fails there again, which only needs reporting once
+        if (!state.reported_eof)
+            state.errors.push_back(std::move(error));
+
+        state.reported_eof = state.reached_eof;
+    }
+
+    synchronize(state, start_position, start_depth);
+
+    // the parser may have advanced past the end of the file
+    auto last_offset = -1;
+    while (is_eof(state, last_offset))
+        last_offset--;
+
+    return ErrorStatement::create(first_token, peek(state, last_offset));
+}
@@ -6,7 +6,7 @@ ColonTypeClause* parse_colon_type_clause(ParseState& state)
 {
     const auto colon_token = expect(state, SyntaxKind::Colon);
     auto type = parse_type(state);
-    return new ColonTypeClause(colon_token, std::move(type));
+    return create_node<ColonTypeClause>(colon_token, std::move(type));
 }
 
 std::optional<TypeListClause*> parse_type_arguments(ParseState& state)
@@ -17,7 +17,7 @@ std::optional<TypeListClause*> parse_type_arguments(ParseState& state)
 
     auto list = parse_type_list(state);
     const auto r_arrow = expect_r_arrow(state);
-    return new TypeListClause(*l_arrow, std::move(list), r_arrow);
+    return create_node<TypeListClause>(*l_arrow, std::move(list), r_arrow);
 }
 
 std::optional<TypeListClause*> parse_type_parameters(ParseState& state)
@@ -28,7 +28,7 @@ std::optional<TypeListClause*> parse_type_parameters(ParseState& state)
 
     auto list = parse_type_list(state, parse_type_parameter);
     const auto r_arrow = expect(state, SyntaxKind::RArrow);
-    return new TypeListClause(*l_arrow, std::move(list), r_arrow);
+    return create_node<TypeListClause>(*l_arrow, std::move(list), r_arrow);
 }
 
 type_ref_ptr_t parse_type_name(ParseState& state)
@@ -44,7 +44,7 @@ type_ref_ptr_t parse_type_name(ParseState& state)
 type_ref_ptr_t parse_literal_type(const ParseState& state)
 {
     const auto token = previous_token_guaranteed(state);
-    const auto value = primitive_from_string(token.get_text());
+    const auto value = primitive_from_token(token);
     return LiteralTypeRef::create(token, value);
 }
 
@@ -59,7 +59,7 @@ type_ref_ptr_t parse_singular_type(ParseState& state)
         return parse_literal_type(state);
 
     const auto token = current_token_guaranteed(state);
-    report_expected_different_syntax(token.span, "type", token.get_text(), false);
+    report_expected_different_syntax(token.span, "type", std::string(token.get_text()), false);
 }
 
 static type_ref_ptr_t parse_union_type(ParseState& state)
@@ -166,7 +166,10 @@ type_ref_ptr_t parse_type_parameter(ParseState& state)
 
 type_ref_ptr_t parse_type(ParseState& state)
 {
-    return parse_nullable_type(state);
+    return parse_nested(state, [&]
+    {
+        return parse_nullable_type(state);
+    });
 }
 
 std::vector<type_ref_ptr_t> parse_type_list(ParseState& state,
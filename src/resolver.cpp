@@ -1,62 +1,62 @@
 #include "ion/resolver.h"
 
 #include "ion/intrinsics.h"
+#include "ion/symbols/type_declaration_symbol.h"
+#include "ion/types/type_name.h"
 
-/** Sets the current context and returns it back to the enclosing context when this struct goes out of scope */
-struct ContextGuard
+void Resolver::push_scope()
 {
-    Resolver* resolver;
-    ResolverContext enclosing;
+    scopes_.emplace_back();
+}
 
-    explicit ContextGuard(Resolver* resolver, const ResolverContext context)
-        : resolver(resolver)
-    {
-        enclosing = resolver->context;
-        resolver->context = context;
-    }
+void Resolver::pop_scope()
+{
+    scopes_.pop_back();
+}
 
-    ~ContextGuard()
-    {
-        resolver->context = enclosing;
-    }
-};
+void Resolver::push_context(const Context inner_context)
+{
+    enclosing_contexts_.push_back(context);
+    context = inner_context;
+}
 
-bool Resolver::is_declared_in_scope(const std::string& name, const std::unordered_map<std::string, bool>& scope)
+void Resolver::pop_context()
 {
-    return scope.contains(name);
+    context = enclosing_contexts_.back();
+    enclosing_contexts_.pop_back();
 }
 
 void Resolver::define(const Token& identifier)
 {
     COMPILER_ASSERT(identifier.is_kind(SyntaxKind::Identifier), "Expected identifier token");
-    define(identifier.get_text());
+    define(identifier.get_atom());
 }
 
-void Resolver::define(const std::string& name)
+void Resolver::define(const atom_t name)
 {
     if (scopes_.empty())
         return;
 
     auto& scope = scopes_.back();
-    scope.insert_or_assign(name, true);
+    scope[name].defined = true;
 }
 
 void Resolver::declare(const Token& identifier)
 {
     COMPILER_ASSERT(identifier.is_kind(SyntaxKind::Identifier), "Expected identifier token");
-    declare(identifier.get_text(), identifier.span);
+    declare(identifier.get_atom(), identifier.span);
 }
 
-void Resolver::declare(const std::string& name, const FileSpan& span)
+void Resolver::declare(const atom_t name, const FileSpan& span)
 {
     if (scopes_.empty())
         return;
 
     auto& scope = scopes_.back();
-    if (is_declared_in_scope(name, scope))
-        report_duplicate_variable(span, name);
+    if (scope.contains(name))
+        report_duplicate_variable(span, std::string(get_spelling(name)));
 
-    scope.insert_or_assign(name, false);
+    scope.emplace(name, ScopedName {});
 }
 
 void Resolver::declare_define(const Token& token)
@@ -65,17 +65,17 @@ void Resolver::declare_define(const Token& token)
     define(token);
 }
 
-void Resolver::declare_define(const std::string& name, const FileSpan& span)
+void Resolver::declare_define(const atom_t name, const FileSpan& span)
 {
     declare(name, span);
     define(name);
 }
 
-bool Resolver::is_defined(const std::string& name) const
+bool Resolver::is_defined(const atom_t name) const
 {
     for (auto i = scopes_.size(); i > 0; i--)
-        if (const auto& scope = scopes_.at(i - 1); is_declared_in_scope(name, scope))
-            return scope.at(name);
+        if (const auto& scope = scopes_.at(i - 1); scope.contains(name))
+            return scope.at(name).defined;
 
     return false;
 }
@@ -86,174 +86,296 @@ void Resolver::resolve_name(const Token& name) const
         return;
 
     const auto& scope = scopes_.back();
-    const auto text = name.get_text();
-    if (is_declared_in_scope(text, scope) && scope.at(text) == false)
+    const auto atom = name.get_atom();
+    if (const auto it = scope.find(atom); it != scope.end() && !it->second.defined)
         report_variable_read_in_own_initializer(name);
-    if (!is_defined(text))
+    if (!is_defined(atom))
         report_variable_not_found(name);
 }
 
-void Resolver::define_intrinsic_name(const std::string& name)
+void Resolver::define_intrinsic_symbol(const named_symbol_ptr_t& symbol)
 {
-    declare_define(Token { .kind = SyntaxKind::Identifier, .text = name });
-    logger::info("Defined intrinsic name '" + name + "' for resolver");
+    declare_define(Token { .kind = SyntaxKind::Identifier, .atom = symbol->name, .text = symbol->get_name() });
+    define_symbol(symbol->name, symbol);
+    logger::info("Defined intrinsic symbol '" + symbol->to_string() + "' for resolver");
 }
 
-void Resolver::visit_ast(const std::vector<statement_ptr_t>& statements)
+void Resolver::bind_declaration_symbol(NamedDeclaration* named_declaration)
 {
-    ScopedAstVisitor::visit_ast(statements, [&]
-    {
-        for (const auto& symbol : intrinsic_symbols)
-            define_intrinsic_name(symbol->name);
-    });
+    const auto name = named_declaration->name.get_atom();
+    const auto symbol = std::make_shared<DeclarationSymbol>(name, named_declaration);
+    define_symbol(name, symbol);
+    named_declaration->symbol = symbol;
+}
+
+void Resolver::bind_type_declaration_symbol(NamedDeclaration* named_declaration, type_ptr_t& type)
+{
+    // type declarations are never looked up by name, only type symbols are
+    named_declaration->symbol = std::make_shared<TypeDeclarationSymbol>(named_declaration->name.get_atom(), std::move(type), named_declaration);
+}
+
+void Resolver::bind_empty_symbol(SyntaxNode& node)
+{
+    node.symbol = std::make_shared<Symbol>();
+}
+
+void Resolver::define_symbol(const atom_t name, const named_symbol_ptr_t& symbol)
+{
+    COMPILER_ASSERT(!scopes_.empty(), "Cannot define symbol; scope stack is empty");
+    auto& scoped_name = scopes_.back()[name];
+    if (symbol->is_type_symbol())
+        scoped_name.type_symbol = symbol;
+    else
+        scoped_name.symbol = symbol;
 }
 
-void Resolver::visit_identifier(Identifier& identifier)
+std::optional<named_symbol_ptr_t> Resolver::find_named_symbol(const atom_t name) const
+{
+    for (auto it = scopes_.rbegin(); it != scopes_.rend(); ++it)
+        if (const auto found = it->find(name); found != it->end() && found->second.symbol.has_value())
+            return found->second.symbol;
+
+    return std::nullopt;
+}
+
+std::optional<named_symbol_ptr_t> Resolver::find_type_symbol(const atom_t name) const
+{
+    for (auto it = scopes_.rbegin(); it != scopes_.rend(); ++it)
+        if (const auto found = it->find(name); found != it->end() && found->second.type_symbol.has_value())
+            return found->second.type_symbol;
+
+    return std::nullopt;
+}
+
+void Resolver::walk_ast(const std::vector<statement_ptr_t>& statements)
+{
+    push_scope();
+    for (const auto& symbol : get_intrinsic_symbols())
+        define_intrinsic_symbol(symbol);
+
+    AstWalker::walk_ast(statements);
+    pop_scope();
+}
+
+void Resolver::enter_identifier(Identifier& identifier)
 {
     resolve_name(identifier.name);
+    if (const auto symbol_opt = find_named_symbol(identifier.name.get_atom()); symbol_opt.has_value())
+    {
+        if (const auto& symbol = *symbol_opt; !symbol->is_declaration_symbol())
+            identifier.symbol = symbol;
+        else
+        {
+            const auto named_symbol = std::make_shared<NamedSymbol>(symbol->name);
+            named_symbol->declaring_symbol = symbol;
+            identifier.symbol = named_symbol;
+        }
+    }
 }
 
-void Resolver::visit_await(Await& await)
+void Resolver::leave_expression_statement(ExpressionStatement& expression_statement)
+{
+    expression_statement.symbol = expression_statement.expression->symbol;
+}
+
+void Resolver::enter_await(Await& await)
 {
     ASSERT_CONTEXT(await, report_invalid_await, Context::AsyncFunction);
-    AstVisitor::visit_await(await);
+    bind_empty_symbol(await);
 }
 
-void Resolver::visit_block(Block& block)
+void Resolver::enter_block(Block&)
 {
     push_scope();
-    AstVisitor::visit_block(block);
+}
+
+void Resolver::leave_block(Block&)
+{
     pop_scope();
 }
 
-void Resolver::visit_type_declaration(TypeDeclaration& type_declaration)
+void Resolver::enter_type_declaration(TypeDeclaration& type_declaration)
 {
     declare(type_declaration.name);
-    AstVisitor::visit_type_declaration(type_declaration);
+}
+
+void Resolver::leave_type_declaration(TypeDeclaration& type_declaration)
+{
     define(type_declaration.name);
+
+    auto type = Type::from(type_declaration.type);
+    bind_type_declaration_symbol(&type_declaration, type);
 }
 
-void Resolver::visit_variable_declaration(VariableDeclaration& variable_declaration)
+void Resolver::enter_variable_declaration(VariableDeclaration& variable_declaration)
 {
     declare(variable_declaration.name);
-    AstVisitor::visit_variable_declaration(variable_declaration);
+}
+
+void Resolver::leave_variable_declaration(VariableDeclaration& variable_declaration)
+{
     define(variable_declaration.name);
+
+    const auto type = variable_declaration.colon_type.has_value()
+                          ? Type::from(variable_declaration.colon_type.value()->type)
+                          : std::optional<type_ptr_t>(std::nullopt);
+
+    const auto name = variable_declaration.name.get_atom();
+    const auto symbol = std::make_shared<DeclarationSymbol>(name, &variable_declaration, type);
+    define_symbol(name, symbol);
+    variable_declaration.symbol = symbol;
 }
 
-void Resolver::visit_event_declaration(EventDeclaration& event_declaration)
+void Resolver::enter_event_declaration(EventDeclaration& event_declaration)
 {
     declare_define(event_declaration.name);
+    bind_declaration_symbol(&event_declaration);
     push_scope();
-    AstVisitor::visit_event_declaration(event_declaration);
+}
+
+void Resolver::leave_event_declaration(EventDeclaration&)
+{
     pop_scope();
 }
 
-void Resolver::visit_enum_declaration(EnumDeclaration& enum_declaration)
+void Resolver::enter_enum_declaration(EnumDeclaration& enum_declaration)
 {
     declare_define(enum_declaration.name);
-    AstVisitor::visit_enum_declaration(enum_declaration);
 }
 
-void Resolver::visit_interface_declaration(InterfaceDeclaration& interface_declaration)
+void Resolver::leave_enum_declaration(EnumDeclaration& enum_declaration)
+{
+    bind_declaration_symbol(&enum_declaration);
+}
+
+void Resolver::enter_interface_declaration(InterfaceDeclaration& interface_declaration)
 {
     declare_define(interface_declaration.name);
-    AstVisitor::visit_interface_declaration(interface_declaration);
 }
 
-void Resolver::visit_interface_field(InterfaceField& interface_field)
+void Resolver::leave_interface_declaration(InterfaceDeclaration& interface_declaration)
+{
+    auto type = Type::from_interface(interface_declaration);
+    bind_type_declaration_symbol(&interface_declaration, type);
+}
+
+void Resolver::enter_interface_field(InterfaceField& interface_field)
 {
     DUPLICATE_MEMBER_CHECK(interface_field, used_interface_members, "interface member");
-    AstVisitor::visit_interface_field(interface_field);
 }
 
-void Resolver::visit_interface_method(InterfaceMethod& interface_method)
+void Resolver::enter_interface_method(InterfaceMethod& interface_method)
 {
     DUPLICATE_MEMBER_CHECK(interface_method, used_interface_members, "interface member");
-    AstVisitor::visit_interface_method(interface_method);
 }
 
-void Resolver::visit_function_declaration(FunctionDeclaration& function_declaration)
+void Resolver::enter_function_declaration(FunctionDeclaration& function_declaration)
 {
     declare_define(function_declaration.name);
+    bind_declaration_symbol(&function_declaration);
     push_scope();
-    AstVisitor::visit_function_declaration(function_declaration);
+}
+
+void Resolver::leave_function_declaration(FunctionDeclaration&)
+{
     pop_scope();
 }
 
-void Resolver::visit_parameter(Parameter& parameter)
+void Resolver::enter_parameter(Parameter& parameter)
 {
     declare_define(parameter.name);
-    AstVisitor::visit_parameter(parameter);
 }
 
-void Resolver::visit_instance_constructor(InstanceConstructor& instance_constructor)
+void Resolver::enter_instance_constructor(InstanceConstructor& instance_constructor)
 {
     declare_define(instance_constructor.name);
-    AstVisitor::visit_instance_constructor(instance_constructor);
+    bind_declaration_symbol(&instance_constructor);
 }
 
-void Resolver::visit_instance_attribute_declarator(InstanceAttributeDeclarator& instance_attribute_declarator)
+void Resolver::enter_instance_attribute_declarator(InstanceAttributeDeclarator& instance_attribute_declarator)
 {
     DUPLICATE_MEMBER_CHECK(instance_attribute_declarator, used_instance_attributes, "instance attribute");
-    AstVisitor::visit_instance_attribute_declarator(instance_attribute_declarator);
 }
 
-void Resolver::visit_instance_name_declarator(InstanceNameDeclarator& instance_name_declarator)
+void Resolver::enter_instance_name_declarator(InstanceNameDeclarator& instance_name_declarator)
 {
-    DUPLICATE_MEMBER_CHECK_CUSTOM_NAME(instance_name_declarator, used_instance_properties, "instance name property", "Name");
-    AstVisitor::visit_instance_name_declarator(instance_name_declarator);
+    DUPLICATE_MEMBER_CHECK_CUSTOM_NAME(instance_name_declarator, used_instance_properties, "instance name property", intern("Name"));
 }
 
-void Resolver::visit_instance_property_declarator(InstancePropertyDeclarator& instance_property_declarator)
+void Resolver::enter_instance_property_declarator(InstancePropertyDeclarator& instance_property_declarator)
 {
     DUPLICATE_MEMBER_CHECK(instance_property_declarator, used_instance_properties, "instance property");
-    AstVisitor::visit_instance_property_declarator(instance_property_declarator);
 }
 
-void Resolver::visit_instance_tag_declarator(InstanceTagDeclarator& instance_tag_declarator)
+void Resolver::enter_instance_tag_declarator(InstanceTagDeclarator& instance_tag_declarator)
 {
     DUPLICATE_MEMBER_CHECK(instance_tag_declarator, used_instance_tags, "instance tag");
-    AstVisitor::visit_instance_tag_declarator(instance_tag_declarator);
 }
 
-void Resolver::visit_break(Break& break_statement)
+void Resolver::enter_break(Break& break_statement)
 {
     ASSERT_CONTEXT(break_statement, report_invalid_break, Context::Loop);
 }
 
-void Resolver::visit_continue(Continue& continue_statement)
+void Resolver::enter_continue(Continue& continue_statement)
 {
     ASSERT_CONTEXT(continue_statement, report_invalid_continue, Context::Loop);
 }
 
-void Resolver::visit_return(Return& return_statement)
+void Resolver::enter_return(Return& return_statement)
 {
     ASSERT_ANY_CONTEXT(return_statement, report_invalid_return, function_contexts);
-    AstVisitor::visit_return(return_statement);
 }
 
 // @formatter:off
-DEFINE_LOOP_VISITOR(while, While);
-DEFINE_LOOP_VISITOR(repeat, Repeat);
-DEFINE_LOOP_VISITOR(for, For);
-DEFINE_LOOP_VISITOR(every, Every);
+DEFINE_LOOP_HOOKS(while, While);
+DEFINE_LOOP_HOOKS(repeat, Repeat);
+DEFINE_LOOP_HOOKS(for, For);
+DEFINE_LOOP_HOOKS(every, Every);
 // @formatter:on
 
-void Resolver::visit_import(Import& import_statement)
+void Resolver::enter_import(Import& import_statement)
 {
     // TODO: validate import path
+    // `*` brings in whatever the module exports, which isn't known until the path is
     for (const auto& name : import_statement.names)
-        declare_define(name);
+        if (name.is_kind(SyntaxKind::Identifier))
+            declare_define(name);
 }
 
-void Resolver::visit_type_name(TypeNameRef& type_name)
+void Resolver::enter_type_name(TypeNameRef& type_name)
 {
     resolve_name(type_name.name);
+    if (const auto symbol_opt = find_type_symbol(type_name.name.get_atom()); symbol_opt.has_value())
+        type_name.symbol = *symbol_opt;
 }
 
-void Resolver::visit_type_parameter(TypeParameterRef& type_parameter)
+void Resolver::enter_type_parameter(TypeParameterRef& type_parameter)
 {
     declare(type_parameter.name);
-    AstVisitor::visit_type_parameter(type_parameter);
+}
+
+void Resolver::leave_type_parameter(TypeParameterRef& type_parameter)
+{
     define(type_parameter.name);
-}
\ No newline at end of file
+}
+
+DEFINE_EMPTY_SYMBOL_HOOK(primitive_literal, PrimitiveLiteral)
+DEFINE_EMPTY_SYMBOL_HOOK(array_literal, ArrayLiteral);
+DEFINE_EMPTY_SYMBOL_HOOK(tuple_literal, TupleLiteral);
+DEFINE_EMPTY_SYMBOL_HOOK(range_literal, RangeLiteral);
+DEFINE_EMPTY_SYMBOL_HOOK(rgb_literal, RgbLiteral);
+DEFINE_EMPTY_SYMBOL_HOOK(hsv_literal, HsvLiteral);
+DEFINE_EMPTY_SYMBOL_HOOK(vector_literal, VectorLiteral);
+DEFINE_EMPTY_SYMBOL_HOOK(interpolated_string, InterpolatedString);
+DEFINE_EMPTY_SYMBOL_HOOK(parenthesized, Parenthesized);
+DEFINE_EMPTY_SYMBOL_HOOK(binary_op, BinaryOp);
+DEFINE_EMPTY_SYMBOL_HOOK(assignment_op, AssignmentOp);
+DEFINE_EMPTY_SYMBOL_HOOK(unary_op, UnaryOp);
+DEFINE_EMPTY_SYMBOL_HOOK(postfix_unary_op, PostfixUnaryOp);
+DEFINE_EMPTY_SYMBOL_HOOK(invocation, Invocation);
+DEFINE_EMPTY_SYMBOL_HOOK(member_access, MemberAccess);
+DEFINE_EMPTY_SYMBOL_HOOK(optional_member_access, OptionalMemberAccess);
+DEFINE_EMPTY_SYMBOL_HOOK(element_access, ElementAccess);
+DEFINE_EMPTY_SYMBOL_HOOK(name_of, NameOf);
+DEFINE_EMPTY_SYMBOL_HOOK(type_of, TypeOf);
\ No newline at end of file
@@ -0,0 +1,252 @@
+#include <bit>
+
+#include "ion/scanning.h"
+
+#if defined(_M_X64) || defined(__x86_64__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#define ION_SCANNING_X86 1
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define ION_TARGET_AVX2
+#else
+#include <cpuid.h>
+#define ION_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+namespace scanning
+{
+    static bool is_whitespace_stop(const char character, char)
+    {
+        return character != ' ' && character != '\t' && character != '\r' && character != '\v' && character != '\f';
+    }
+
+    static bool is_identifier_stop(const char character, char)
+    {
+        const auto lower = static_cast<unsigned char>(character | 0x20);
+        return character != '_'
+               && static_cast<unsigned char>(lower - 'a') > 25
+               && static_cast<unsigned char>(character - '0') > 9;
+    }
+
+    static bool is_line_stop(const char character, char)
+    {
+        return character == '\n';
+    }
+
+    static bool is_string_body_stop(const char character, const char terminator)
+    {
+        return character == terminator || character == '\n' || character == '#' || character == '}';
+    }
+
+    template <bool (*IsStop)(char, char)>
+    static size_t scan_scalar(const std::string_view text, size_t position, const char terminator)
+    {
+        while (position < text.size() && !IsStop(text[position], terminator))
+            position++;
+
+        return position;
+    }
+
+    using scanner_t = size_t (*)(std::string_view, size_t, char);
+
+    struct Scanners
+    {
+        const char* name;
+        scanner_t whitespace, identifier, line, string_body;
+    };
+
+    static constexpr Scanners scalar_scanners = {
+        "scalar",
+        scan_scalar<is_whitespace_stop>,
+        scan_scalar<is_identifier_stop>,
+        scan_scalar<is_line_stop>,
+        scan_scalar<is_string_body_stop>
+    };
+
+#ifdef ION_SCANNING_X86
+    /** Bytes of `chunk` that are between `low` and `high` (inclusive), using the signed compare SSE2 offers */
+    static __m128i in_range_128(const __m128i chunk, const char low, const char high)
+    {
+        const auto shifted = _mm_add_epi8(chunk, _mm_set1_epi8(static_cast<char>(0x80 - low)));
+        return _mm_cmplt_epi8(shifted, _mm_set1_epi8(static_cast<char>(0x80 + (high - low + 1))));
+    }
+
+    static unsigned whitespace_stops_128(const __m128i chunk, char)
+    {
+        const auto spaces = _mm_cmpeq_epi8(chunk, _mm_set1_epi8(' '));
+        const auto tabs = _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\t'));
+        const auto controls = in_range_128(chunk, '\v', '\r'); // \v \f \r
+        const auto line_feeds = _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\n'));
+        const auto whitespace = _mm_andnot_si128(line_feeds, _mm_or_si128(_mm_or_si128(spaces, tabs), controls));
+        return ~static_cast<unsigned>(_mm_movemask_epi8(whitespace)) & 0xFFFF;
+    }
+
+    static unsigned identifier_stops_128(const __m128i chunk, char)
+    {
+        const auto lower = _mm_or_si128(chunk, _mm_set1_epi8(0x20));
+        const auto letters = in_range_128(lower, 'a', 'z');
+        const auto digits = in_range_128(chunk, '0', '9');
+        const auto underscores = _mm_cmpeq_epi8(chunk, _mm_set1_epi8('_'));
+        const auto identifier = _mm_or_si128(_mm_or_si128(letters, digits), underscores);
+        return ~static_cast<unsigned>(_mm_movemask_epi8(identifier)) & 0xFFFF;
+    }
+
+    static unsigned line_stops_128(const __m128i chunk, char)
+    {
+        return static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('\n'))));
+    }
+
+    static unsigned string_body_stops_128(const __m128i chunk, const char terminator)
+    {
+        const auto terminators = _mm_cmpeq_epi8(chunk, _mm_set1_epi8(terminator));
+        const auto line_feeds = _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\n'));
+        const auto hashtags = _mm_cmpeq_epi8(chunk, _mm_set1_epi8('#'));
+        const auto braces = _mm_cmpeq_epi8(chunk, _mm_set1_epi8('}'));
+        const auto stops = _mm_or_si128(_mm_or_si128(terminators, line_feeds), _mm_or_si128(hashtags, braces));
+        return static_cast<unsigned>(_mm_movemask_epi8(stops));
+    }
+
+    template <unsigned (*StopMask)(__m128i, char), bool (*IsStop)(char, char)>
+    static size_t scan_sse2(const std::string_view text, size_t position, const char terminator)
+    {
+        while (position + 16 <= text.size())
+        {
+            const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text.data() + position));
+            if (const auto stops = StopMask(chunk, terminator); stops != 0)
+                return position + std::countr_zero(stops);
+
+            position += 16;
+        }
+
+        return scan_scalar<IsStop>(text, position, terminator);
+    }
+
+    static constexpr Scanners sse2_scanners = {
+        "SSE2",
+        scan_sse2<whitespace_stops_128, is_whitespace_stop>,
+        scan_sse2<identifier_stops_128, is_identifier_stop>,
+        scan_sse2<line_stops_128, is_line_stop>,
+        scan_sse2<string_body_stops_128, is_string_body_stop>
+    };
+
+    ION_TARGET_AVX2 static __m256i in_range_256(const __m256i chunk, const char low, const char high)
+    {
+        const auto shifted = _mm256_add_epi8(chunk, _mm256_set1_epi8(static_cast<char>(0x80 - low)));
+        return _mm256_cmpgt_epi8(_mm256_set1_epi8(static_cast<char>(0x80 + (high - low + 1))), shifted);
+    }
+
+    ION_TARGET_AVX2 static unsigned whitespace_stops_256(const __m256i chunk, char)
+    {
+        const auto spaces = _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(' '));
+        const auto tabs = _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\t'));
+        const auto controls = in_range_256(chunk, '\v', '\r');
+        const auto line_feeds = _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\n'));
+        const auto whitespace = _mm256_andnot_si256(line_feeds, _mm256_or_si256(_mm256_or_si256(spaces, tabs), controls));
+        return ~static_cast<unsigned>(_mm256_movemask_epi8(whitespace));
+    }
+
+    ION_TARGET_AVX2 static unsigned identifier_stops_256(const __m256i chunk, char)
+    {
+        const auto lower = _mm256_or_si256(chunk, _mm256_set1_epi8(0x20));
+        const auto letters = in_range_256(lower, 'a', 'z');
+        const auto digits = in_range_256(chunk, '0', '9');
+        const auto underscores = _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('_'));
+        const auto identifier = _mm256_or_si256(_mm256_or_si256(letters, digits), underscores);
+        return ~static_cast<unsigned>(_mm256_movemask_epi8(identifier));
+    }
+
+    ION_TARGET_AVX2 static unsigned line_stops_256(const __m256i chunk, char)
+    {
+        return static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\n'))));
+    }
+
+    ION_TARGET_AVX2 static unsigned string_body_stops_256(const __m256i chunk, const char terminator)
+    {
+        const auto terminators = _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(terminator));
+        const auto line_feeds = _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\n'));
+        const auto hashtags = _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('#'));
+        const auto braces = _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('}'));
+        const auto stops = _mm256_or_si256(_mm256_or_si256(terminators, line_feeds), _mm256_or_si256(hashtags, braces));
+        return static_cast<unsigned>(_mm256_movemask_epi8(stops));
+    }
+
+    template <unsigned (*StopMask)(__m256i, char), bool (*IsStop)(char, char)>
+    ION_TARGET_AVX2 static size_t scan_avx2(const std::string_view text, size_t position, const char terminator)
+    {
+        while (position + 32 <= text.size())
+        {
+            const auto chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text.data() + position));
+            if (const auto stops = StopMask(chunk, terminator); stops != 0)
+                return position + std::countr_zero(stops);
+
+            position += 32;
+        }
+
+        return scan_scalar<IsStop>(text, position, terminator);
+    }
+
+    static constexpr Scanners avx2_scanners = {
+        "AVX2",
+        scan_avx2<whitespace_stops_256, is_whitespace_stop>,
+        scan_avx2<identifier_stops_256, is_identifier_stop>,
+        scan_avx2<line_stops_256, is_line_stop>,
+        scan_avx2<string_body_stops_256, is_string_body_stop>
+    };
+
+    static bool supports_avx2()
+    {
+#ifdef _MSC_VER
+        int info[4];
+        __cpuid(info, 1);
+        const auto has_os_avx = (info[2] & (1 << 27)) != 0 && (info[2] & (1 << 28)) != 0;
+        if (!has_os_avx || (_xgetbv(0) & 0x6) != 0x6)
+            return false;
+
+        __cpuidex(info, 7, 0);
+        return (info[1] & (1 << 5)) != 0;
+#else
+        return __builtin_cpu_supports("avx2");
+#endif
+    }
+#endif
+
+    static const Scanners& select_scanners()
+    {
+#ifdef ION_SCANNING_X86
+        if (supports_avx2())
+            return avx2_scanners;
+
+        return sse2_scanners;
+#else
+        return scalar_scanners;
+#endif
+    }
+
+    static const Scanners& scanners = select_scanners();
+
+    size_t whitespace_end(const std::string_view text, const size_t position)
+    {
+        return scanners.whitespace(text, position, '\0');
+    }
+
+    size_t identifier_end(const std::string_view text, const size_t position)
+    {
+        return scanners.identifier(text, position, '\0');
+    }
+
+    size_t line_end(const std::string_view text, const size_t position)
+    {
+        return scanners.line(text, position, '\0');
+    }
+
+    size_t string_body_end(const std::string_view text, const size_t position, const char terminator)
+    {
+        return scanners.string_body(text, position, terminator);
+    }
+
+    const char* implementation_name()
+    {
+        return scanners.name;
+    }
+}
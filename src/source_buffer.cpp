@@ -0,0 +1,136 @@
+#include <cstring>
+#include <fstream>
+#include <utility>
+
+#include "ion/source_buffer.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+SourceBuffer::~SourceBuffer()
+{
+    release();
+}
+
+SourceBuffer::SourceBuffer(SourceBuffer&& other) noexcept
+    : data_(std::exchange(other.data_, nullptr)),
+      size_(std::exchange(other.size_, 0)),
+      owned_(std::move(other.owned_)),
+      mapped_(std::exchange(other.mapped_, false))
+{
+}
+
+SourceBuffer& SourceBuffer::operator=(SourceBuffer&& other) noexcept
+{
+    if (this == &other)
+        return *this;
+
+    release();
+    data_ = std::exchange(other.data_, nullptr);
+    size_ = std::exchange(other.size_, 0);
+    owned_ = std::move(other.owned_);
+    mapped_ = std::exchange(other.mapped_, false);
+    return *this;
+}
+
+void SourceBuffer::release()
+{
+    if (mapped_)
+    {
+#ifdef _WIN32
+        UnmapViewOfFile(data_);
+#else
+        munmap(const_cast<char*>(data_), size_);
+#endif
+    }
+
+    owned_.reset();
+    data_ = nullptr;
+    size_ = 0;
+    mapped_ = false;
+}
+
+SourceBuffer SourceBuffer::from_string(const std::string_view text)
+{
+    SourceBuffer buffer;
+    buffer.owned_ = std::make_unique<char[]>(text.size());
+    std::memcpy(buffer.owned_.get(), text.data(), text.size());
+    buffer.data_ = buffer.owned_.get();
+    buffer.size_ = text.size();
+    return buffer;
+}
+
+/** Returns the mapped contents of the file at `path`, or `nullptr` if it couldn't be mapped (empty files can't be) */
+static const char* map_file(const std::string& path, size_t& size)
+{
+#ifdef _WIN32
+    const auto file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return nullptr;
+
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0)
+    {
+        CloseHandle(file);
+        return nullptr;
+    }
+
+    // the view keeps the mapping alive, so neither handle is needed after this
+    const auto mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (mapping == nullptr)
+        return nullptr;
+
+    const auto data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    size = static_cast<size_t>(file_size.QuadPart);
+    return static_cast<const char*>(data);
+#else
+    const auto file = open(path.c_str(), O_RDONLY);
+    if (file < 0)
+        return nullptr;
+
+    struct stat file_stat {};
+    if (fstat(file, &file_stat) != 0 || file_stat.st_size == 0)
+    {
+        close(file);
+        return nullptr;
+    }
+
+    size = static_cast<size_t>(file_stat.st_size);
+    const auto data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+    close(file);
+    return data == MAP_FAILED ? nullptr : static_cast<const char*>(data);
+#endif
+}
+
+std::optional<SourceBuffer> SourceBuffer::from_file(const std::string& path)
+{
+    SourceBuffer buffer;
+    if (const auto data = map_file(path, buffer.size_); data != nullptr)
+    {
+        buffer.data_ = data;
+        buffer.mapped_ = true;
+        return buffer;
+    }
+
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open())
+        return std::nullopt;
+
+    const auto size = static_cast<size_t>(file.tellg());
+    buffer.owned_ = std::make_unique<char[]>(size);
+    file.seekg(0);
+    file.read(buffer.owned_.get(), static_cast<std::streamsize>(size));
+    buffer.data_ = buffer.owned_.get();
+    buffer.size_ = static_cast<size_t>(file.gcount());
+    return buffer;
+}
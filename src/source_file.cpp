@@ -1,33 +1,72 @@
-#include <fstream>
+#include <algorithm>
 #include <string>
 
 #include "ion/diagnostics.h"
 #include "ion/source_file.h"
 
 #include "ion/logger.h"
+#include "ion/scanning.h"
 #include "ion/utility/basic.h"
 
-static std::string read_file(const std::string& path)
+void SourceFile::index_lines()
 {
-    std::ifstream file(path);
-    if (!file.is_open())
-        logger::error("Failed to open file at: " + path);
+    line_starts.clear();
+    line_starts.push_back(0);
+    for (auto position = scanning::line_end(text, 0); position < text.size(); position = scanning::line_end(text, position + 1))
+        line_starts.push_back(static_cast<int>(position) + 1);
+}
 
-    std::string line;
-    std::string contents;
-    while (std::getline(file, line))
-        contents += line + '\n';
+int SourceFile::get_line_number(const int position) const
+{
+    const auto next_line_start = std::ranges::upper_bound(line_starts, position);
+    return static_cast<int>(next_line_start - line_starts.begin());
+}
 
-    file.close();
-    return contents;
+std::string_view SourceFile::get_line_text(const int line) const
+{
+    if (line < 1 || line > static_cast<int>(line_starts.size()))
+        return {};
+
+    const auto start = line_starts[line - 1];
+    const auto end = line < static_cast<int>(line_starts.size()) ? line_starts[line] - 1 : static_cast<int>(text.size());
+    const auto line_text = text.substr(start, end - start);
+    return line_text.ends_with('\r') ? line_text.substr(0, line_text.size() - 1) : line_text;
+}
+
+FileLocation SourceFile::get_location(const int position) const
+{
+    const auto line = get_line_number(position);
+    return FileLocation {
+        .position = position,
+        .line = line,
+        .column = position - line_starts[line - 1],
+        .file = this
+    };
+}
+
+void SourceFile::apply(const SourceEdit& edit)
+{
+    COMPILER_ASSERT(edit.start <= edit.end && edit.end <= text.size(), "Source edit is out of bounds of '" + path + "'");
+
+    std::string edited_text;
+    edited_text.reserve(text.size() - (edit.end - edit.start) + edit.replacement.size());
+    edited_text.append(text.substr(0, edit.start));
+    edited_text.append(edit.replacement);
+    edited_text.append(text.substr(edit.end));
+
+    buffer = SourceBuffer::from_string(edited_text);
+    text = buffer.view();
+    index_lines();
 }
 
 SourceFile create_file(const std::string& path)
 {
-    const auto text = read_file(path);
-    logger::info("Created source file from path: " + path);
+    auto buffer = SourceBuffer::from_file(path);
+    if (!buffer.has_value())
+        logger::error("Failed to open file at: " + path);
 
-    return SourceFile(path, text);
+    logger::info("Created source file from path: " + path);
+    return SourceFile(path, std::move(*buffer));
 }
 
 std::string format_location(const FileLocation& location, const bool include_file_path, const bool colors)
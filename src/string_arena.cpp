@@ -0,0 +1,39 @@
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+#include "ion/string_arena.h"
+
+char* StringArena::allocate(const size_t size)
+{
+    if (chunks_.empty() || chunk_used_ + size > chunk_capacity_)
+    {
+        chunk_capacity_ = std::max(chunk_size, size);
+        chunk_used_ = 0;
+        chunks_.push_back(std::make_unique<char[]>(chunk_capacity_));
+    }
+
+    const auto result = chunks_.back().get() + chunk_used_;
+    chunk_used_ += size;
+    return result;
+}
+
+std::string_view StringArena::store(const std::string_view text)
+{
+    if (text.empty())
+        return {};
+
+    const auto data = allocate(text.size());
+    std::memcpy(data, text.data(), text.size());
+    return { data, text.size() };
+}
+
+void StringArena::absorb(StringArena&& other)
+{
+    // keep our partially used chunk last so allocation can continue in it
+    const auto insert_position = chunks_.empty() ? chunks_.end() : chunks_.end() - 1;
+    chunks_.insert(insert_position, std::make_move_iterator(other.chunks_.begin()), std::make_move_iterator(other.chunks_.end()));
+    other.chunks_.clear();
+    other.chunk_used_ = 0;
+    other.chunk_capacity_ = 0;
+}
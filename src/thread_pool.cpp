@@ -0,0 +1,72 @@
+#include <algorithm>
+
+#include "ion/thread_pool.h"
+
+ThreadPool::ThreadPool(const size_t thread_count)
+{
+    workers_.reserve(thread_count);
+    for (size_t i = 0; i < thread_count; i++)
+        workers_.emplace_back(&ThreadPool::work, this);
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard lock(mutex_);
+        stopping_ = true;
+    }
+
+    task_available_.notify_all();
+    for (auto& worker : workers_)
+        worker.join();
+}
+
+void ThreadPool::work()
+{
+    while (true)
+    {
+        std::function<void ()> task;
+        {
+            std::unique_lock lock(mutex_);
+            task_available_.wait(lock, [this]
+            {
+                return stopping_ || !tasks_.empty();
+            });
+
+            if (tasks_.empty())
+                return;
+
+            task = std::move(tasks_.front());
+            tasks_.pop();
+        }
+
+        task();
+    }
+}
+
+bool ThreadPool::try_run_task()
+{
+    std::function<void ()> task;
+    {
+        std::lock_guard lock(mutex_);
+        if (tasks_.empty())
+            return false;
+
+        task = std::move(tasks_.front());
+        tasks_.pop();
+    }
+
+    task();
+    return true;
+}
+
+size_t ThreadPool::default_thread_count()
+{
+    return std::max<size_t>(1, std::thread::hardware_concurrency());
+}
+
+ThreadPool& ThreadPool::shared()
+{
+    static ThreadPool pool;
+    return pool;
+}
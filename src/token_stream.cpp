@@ -0,0 +1,109 @@
+#include <algorithm>
+
+#include "ion/token_stream.h"
+#include "ion/diagnostics.h"
+#include "ion/lexer.h"
+
+TokenStream::TokenStream(const SourceFile& file)
+    : state_ { { .file = &file }, get_start_location(file), {}, &file.string_arena },
+      window_(initial_capacity)
+{
+    if (const auto chunk_count = lexing_chunk_count(file); chunk_count > 1)
+        pretokenize(file, chunk_count);
+}
+
+/**
+ * Lexes the whole file in parallel chunks. If that hits a lexer error the file is lexed on demand after all, so the error
+ * is still reported when the parser reaches it, along with the syntax errors before it.
+ */
+void TokenStream::pretokenize(const SourceFile& file, const size_t chunk_count)
+{
+    try
+    {
+        ErrorDeferral deferral;
+        pretokenized_ = tokenize_chunked(file, chunk_count);
+    }
+    catch (const DeferredError&)
+    {
+    }
+}
+
+const Token* TokenStream::at(const int index)
+{
+    if (index < 0)
+        return nullptr;
+
+    while (index >= first_ + count_)
+        if (!fill())
+            return nullptr;
+
+    COMPILER_ASSERT(index >= first_, "Parser attempted to access a discarded token (index " + std::to_string(index) + ")");
+    return &window_[index & (window_.size() - 1)];
+}
+
+void TokenStream::discard_before(const int index)
+{
+    // the last few lexed tokens are always kept, so the end of the file can still be found and reported at
+    const auto new_first = std::min(index, lexed_count()) - lookbehind;
+    if (new_first <= first_)
+        return;
+
+    count_ -= new_first - first_;
+    first_ = new_first;
+}
+
+/**
+ * Lexes the next batch of tokens into the window (or takes the next token of a pretokenized file), returns false once
+ * the file is exhausted.
+ * A deferred lexer error also exhausts the stream, since lexing can't resume from the middle of a bad token.
+ */
+bool TokenStream::fill()
+{
+    if (exhausted_)
+        return false;
+
+    if (pretokenized_.has_value())
+    {
+        exhausted_ = next_pretokenized_ == pretokenized_->size();
+        if (!exhausted_)
+            push(pretokenized_->get_token(next_pretokenized_++));
+
+        return !exhausted_;
+    }
+
+    state_.tokens.clear();
+    try
+    {
+        if (!lex_next(state_))
+        {
+            exhausted_ = true;
+            return false;
+        }
+    }
+    catch (const DeferredError&)
+    {
+        exhausted_ = true;
+        throw;
+    }
+
+    for (const auto& token : state_.tokens)
+        push(token);
+
+    return true;
+}
+
+void TokenStream::push(const Token& token)
+{
+    if (count_ == static_cast<int>(window_.size()))
+    {
+        // the window is indexed by absolute token index, so every token has to be placed again under the new mask
+        std::vector<Token> grown(window_.size() * 2);
+        for (auto index = first_; index < first_ + count_; index++)
+            grown[index & (grown.size() - 1)] = window_[index & (window_.size() - 1)];
+
+        window_ = std::move(grown);
+    }
+
+    window_[(first_ + count_) & (window_.size() - 1)] = token;
+    count_++;
+}
@@ -0,0 +1,164 @@
+#include "ion/token_table.h"
+#include "ion/diagnostics.h"
+#include "ion/source_file.h"
+
+TokenTable::TokenTable(const SourceFile& file)
+    : file_(&file)
+{
+}
+
+void TokenTable::push(const Token& token)
+{
+    const auto index = static_cast<token_index_t>(kinds_.size());
+    const auto offset = static_cast<uint32_t>(token.span.start.position);
+    const auto length = static_cast<uint32_t>(token.span.end.position - token.span.start.position);
+    COMPILER_ASSERT(token.span.start.position >= 0 && static_cast<size_t>(offset) + length <= file_->text.size() + 1,
+                    "Token table was given a token outside of its file: " + token.format());
+
+    kinds_.push_back(token.kind);
+    offsets_.push_back(offset);
+    lengths_.push_back(length);
+    atoms_.push_back(token.atom);
+
+    // only keep text that isn't a view of exactly the span (unescaped strings, interpolated string parts)
+    const auto text = token.get_text();
+    const auto source = file_->text;
+    if (text.data() != source.data() + offset || text.size() != length)
+    {
+        TextOverride text_override {};
+        text_override.in_arena = text.data() < source.data() || text.data() + text.size() > source.data() + source.size();
+        if (text_override.in_arena)
+            text_override.arena_text = text;
+        else
+        {
+            text_override.relative_offset = static_cast<uint32_t>(text.data() - source.data() - offset);
+            text_override.length = static_cast<uint32_t>(text.size());
+        }
+
+        text_overrides_.emplace(index, text_override);
+    }
+
+    if (token.number_value.has_value())
+        number_values_.emplace(index, *token.number_value);
+}
+
+void TokenTable::append(const TokenTable& other)
+{
+    COMPILER_ASSERT(other.file_ == file_, "Attempted to append tokens from a different file");
+    const auto index_offset = static_cast<token_index_t>(kinds_.size());
+    kinds_.insert(kinds_.end(), other.kinds_.begin(), other.kinds_.end());
+    offsets_.insert(offsets_.end(), other.offsets_.begin(), other.offsets_.end());
+    lengths_.insert(lengths_.end(), other.lengths_.begin(), other.lengths_.end());
+    atoms_.insert(atoms_.end(), other.atoms_.begin(), other.atoms_.end());
+    for (const auto& [index, text] : other.text_overrides_)
+        text_overrides_.emplace(index_offset + index, text);
+    for (const auto& [index, value] : other.number_values_)
+        number_values_.emplace(index_offset + index, value);
+}
+
+/** Re-keys a sparse per-token map after [`first`, `last`) was replaced by `replacement`'s tokens */
+template <typename T>
+static void splice_sparse(std::unordered_map<token_index_t, T>& values,
+                          const std::unordered_map<token_index_t, T>& replacement_values,
+                          const token_index_t first,
+                          const token_index_t last,
+                          const token_index_t inserted_count)
+{
+    std::unordered_map<token_index_t, T> spliced;
+    spliced.reserve(values.size() + replacement_values.size());
+    for (const auto& [index, value] : values)
+    {
+        if (index < first)
+            spliced.emplace(index, value);
+        else if (index >= last)
+            spliced.emplace(index - (last - first) + inserted_count, value);
+    }
+
+    for (const auto& [index, value] : replacement_values)
+        spliced.emplace(first + index, value);
+
+    values = std::move(spliced);
+}
+
+void TokenTable::splice(const token_index_t first, const token_index_t last, const TokenTable& replacement, const int64_t offset_delta)
+{
+    COMPILER_ASSERT(first <= last && last <= kinds_.size() && replacement.file_ == file_, "Invalid token table splice");
+    const auto inserted_count = static_cast<token_index_t>(replacement.size());
+    const auto replace_range = [&](auto& values, const auto& replacement_values)
+    {
+        values.erase(values.begin() + first, values.begin() + last);
+        values.insert(values.begin() + first, replacement_values.begin(), replacement_values.end());
+    };
+
+    replace_range(kinds_, replacement.kinds_);
+    replace_range(offsets_, replacement.offsets_);
+    replace_range(lengths_, replacement.lengths_);
+    replace_range(atoms_, replacement.atoms_);
+    for (auto index = first + inserted_count; index < offsets_.size(); index++)
+        offsets_[index] = static_cast<uint32_t>(offsets_[index] + offset_delta);
+
+    splice_sparse(text_overrides_, replacement.text_overrides_, first, last, inserted_count);
+    splice_sparse(number_values_, replacement.number_values_, first, last, inserted_count);
+}
+
+void TokenTable::reserve(const size_t token_count)
+{
+    kinds_.reserve(token_count);
+    offsets_.reserve(token_count);
+    lengths_.reserve(token_count);
+    atoms_.reserve(token_count);
+}
+
+token_index_t TokenTable::find_first_ending_at(const size_t position) const
+{
+    // tokens don't overlap, so their ends are sorted just like their offsets
+    token_index_t low = 0;
+    auto high = static_cast<token_index_t>(kinds_.size());
+    while (low < high)
+    {
+        const auto middle = low + (high - low) / 2;
+        if (offsets_[middle] + lengths_[middle] < position)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+
+    return low;
+}
+
+std::string_view TokenTable::get_text(const token_index_t index) const
+{
+    if (const auto it = text_overrides_.find(index); it != text_overrides_.end())
+    {
+        const auto& text_override = it->second;
+        return text_override.in_arena
+                   ? text_override.arena_text
+                   : file_->text.substr(offsets_[index] + text_override.relative_offset, text_override.length);
+    }
+
+    return file_->text.substr(offsets_[index], lengths_[index]);
+}
+
+FileSpan TokenTable::get_span(const token_index_t index) const
+{
+    const auto start = static_cast<int>(offsets_[index]);
+    return create_span(file_->get_location(start), file_->get_location(start + static_cast<int>(lengths_[index])));
+}
+
+Token TokenTable::get_token(const token_index_t index) const
+{
+    const auto number_value = number_values_.find(index);
+    return Token {
+        .kind = kinds_[index],
+        .atom = atoms_[index],
+        .span = get_span(index),
+        .text = get_text(index),
+        .number_value = number_value != number_values_.end() ? std::optional(number_value->second) : std::nullopt
+    };
+}
+
+size_t TokenTable::memory_usage() const
+{
+    return kinds_.capacity() * sizeof(SyntaxKind) + (offsets_.capacity() + lengths_.capacity()) * sizeof(uint32_t)
+           + atoms_.capacity() * sizeof(atom_t);
+}
@@ -3,13 +3,7 @@
 
 #include "ion/types/all.h"
 
-template <typename To, typename From>
-To* dynamic_unique_ptr_cast(std::unique_ptr<From>& from)
-{
-    return dynamic_cast<To*>(from.get());
-}
-
-static PrimitiveTypeKind get_primitive_type_kind(const std::string& primitive_name)
+static PrimitiveTypeKind get_primitive_type_kind(const std::string_view primitive_name)
 {
     if (primitive_name == "number")
         return PrimitiveTypeKind::Number;
@@ -21,10 +15,10 @@ static PrimitiveTypeKind get_primitive_type_kind(const std::string& primitive_na
     return PrimitiveTypeKind::Void;
 }
 
-static std::vector<type_ptr_t> from_list(std::vector<type_ref_ptr_t>& list)
+static std::vector<type_ptr_t> from_list(const std::vector<type_ref_ptr_t>& list)
 {
     std::vector<type_ptr_t> result;
-    for (auto& type_ref : list)
+    for (const auto type_ref : list)
         result.push_back(Type::from(type_ref));
 
     return result;
@@ -49,61 +43,62 @@ type_ptr_t from_type_parameter(TypeParameterRef* type_parameter)
                                   ? Type::from(*type_parameter->default_type)
                                   : std::optional<type_ptr_t>(std::nullopt);
 
-    return std::make_shared<TypeParameter>(type_parameter->name.get_text(), base_type, default_type);
+    return std::make_shared<TypeParameter>(std::string(type_parameter->name.get_text()), base_type, default_type);
 }
 
 type_ptr_t Type::from_interface(const InterfaceDeclaration& declaration)
 {
     InterfaceType::member_map_t members;
     for (auto& member : declaration.members->statements)
-        if (const auto field = dynamic_unique_ptr_cast<InterfaceField>(member))
-            members.insert_or_assign(std::make_shared<LiteralType>(field->name.get_text()), from(field->type));
-        else if (const auto method = dynamic_unique_ptr_cast<InterfaceMethod>(member))
-            members.insert_or_assign(std::make_shared<LiteralType>(method->name.get_text()), from_function_like(method));
+        if (const auto field = node_cast<InterfaceField>(member))
+            members.insert_or_assign(std::make_shared<LiteralType>(std::string(field->name.get_text())), from(field->type));
+        else if (const auto method = node_cast<InterfaceMethod>(member))
+            members.insert_or_assign(std::make_shared<LiteralType>(std::string(method->name.get_text())), from_function_like(method));
 
     const auto type_parameters = declaration.type_parameters.has_value()
                                      ? from_list(declaration.type_parameters.value()->list)
                                      : std::vector<type_ptr_t>();
 
-    return std::make_unique<InterfaceType>(declaration.name.get_text(), members, type_parameters);
+    return std::make_unique<InterfaceType>(std::string(declaration.name.get_text()), members, type_parameters);
 }
 
-type_ptr_t Type::from(type_ref_ptr_t& type_ref)
+type_ptr_t Type::from(TypeRef* type_ref)
 {
-    std::optional<type_ptr_t> result;
-    if (const auto primitive_type = dynamic_unique_ptr_cast<PrimitiveTypeRef>(type_ref))
-        result = std::make_shared<PrimitiveType>(get_primitive_type_kind(primitive_type->get_text()));
-    if (const auto type_name = dynamic_unique_ptr_cast<TypeNameRef>(type_ref))
+    switch (type_ref->kind)
     {
-        auto type_arguments = type_name->type_arguments.has_value()
-                                  ? from_list(type_name->type_arguments.value()->list)
-                                  : std::vector<type_ptr_t>();
+        case NodeKind::PrimitiveTypeRef:
+            return std::make_shared<PrimitiveType>(get_primitive_type_kind(type_ref->get_text()));
+        case NodeKind::TypeNameRef:
+        {
+            const auto type_name = static_cast<TypeNameRef*>(type_ref);
+            auto type_arguments = type_name->type_arguments.has_value()
+                                      ? from_list(type_name->type_arguments.value()->list)
+                                      : std::vector<type_ptr_t>();
 
-        result = std::make_shared<TypeName>(type_name->name.get_text(), std::move(type_arguments));
+            return std::make_shared<TypeName>(std::string(type_name->name.get_text()), std::move(type_arguments));
+        }
+        case NodeKind::LiteralTypeRef:
+            return std::make_shared<LiteralType>(static_cast<LiteralTypeRef*>(type_ref)->value);
+        case NodeKind::NullableTypeRef:
+            return std::make_shared<NullableType>(from(static_cast<NullableTypeRef*>(type_ref)->non_nullable_type));
+        case NodeKind::ArrayTypeRef:
+            return std::make_shared<ArrayType>(from(static_cast<ArrayTypeRef*>(type_ref)->element_type));
+        case NodeKind::TupleTypeRef:
+            return std::make_shared<TupleType>(from_list(static_cast<TupleTypeRef*>(type_ref)->element_types));
+        case NodeKind::UnionTypeRef:
+            return std::make_shared<UnionType>(from_list(static_cast<UnionTypeRef*>(type_ref)->types));
+        case NodeKind::IntersectionTypeRef:
+            return std::make_shared<IntersectionType>(from_list(static_cast<IntersectionTypeRef*>(type_ref)->types));
+        // case NodeKind::ObjectTypeRef:
+        //     return std::make_shared<ObjectType>(from_list(function_type->parameter_types), from(function_type->return_type));
+        case NodeKind::FunctionTypeRef:
+            return from_function_like(static_cast<FunctionTypeRef*>(type_ref));
+        case NodeKind::TypeParameterRef:
+            return from_type_parameter(static_cast<TypeParameterRef*>(type_ref));
+
+        default:
+            report_compiler_error(std::string("Failed to convert type ref to type: ") + typeid(*type_ref).name());
     }
-    if (const auto literal_type = dynamic_unique_ptr_cast<LiteralTypeRef>(type_ref))
-        result = std::make_shared<LiteralType>(literal_type->value);
-    if (const auto nullable_type = dynamic_unique_ptr_cast<NullableTypeRef>(type_ref))
-        result = std::make_shared<NullableType>(from(nullable_type->non_nullable_type));
-    if (const auto array_type = dynamic_unique_ptr_cast<ArrayTypeRef>(type_ref))
-        result = std::make_shared<ArrayType>(from(array_type->element_type));
-    if (const auto tuple_type = dynamic_unique_ptr_cast<TupleTypeRef>(type_ref))
-        result = std::make_shared<TupleType>(from_list(tuple_type->element_types));
-    if (const auto union_type = dynamic_unique_ptr_cast<UnionTypeRef>(type_ref))
-        result = std::make_shared<UnionType>(from_list(union_type->types));
-    if (const auto intersection_type = dynamic_unique_ptr_cast<IntersectionTypeRef>(type_ref))
-        result = std::make_shared<IntersectionType>(from_list(intersection_type->types));
-    // if (const auto object_type = reinterpret_unique_ptr_cast<ObjectTypeRef>(std::move(type_ref)))
-    //     result = std::make_shared<ObjectType>(from_list(function_type->parameter_types), from(function_type->return_type));
-    if (const auto function_type = dynamic_unique_ptr_cast<FunctionTypeRef>(type_ref))
-        result = from_function_like(function_type);
-    if (const auto type_parameter = dynamic_unique_ptr_cast<TypeParameterRef>(type_ref))
-        result = from_type_parameter(type_parameter);
-
-    if (result.has_value())
-        return *result;
-
-    report_compiler_error(std::string("Failed to convert type ref to type: ") + typeid(*type_ref).name());
 }
 
 type_ptr_t Type::lower(const type_ptr_t& type)